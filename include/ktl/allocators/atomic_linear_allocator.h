@@ -0,0 +1,199 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/alignment.h"
+#include "atomic_linear_allocator_fwd.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A thread-safe linear allocator which gives out chunks of its internal stack without locking.
+	 * The offset and the number of live allocations are kept in a single atomic word, so allocating is a single compare-and-swap.
+	 * When the last allocation is deallocated the whole stack is reclaimed, which makes it ideal for per-batch arenas shared by worker threads.
+	 * @note Has a max allocation size of the @p Size given, which must fit in 32 bits.
+	*/
+	template<size_t Size>
+	class atomic_linear_allocator
+	{
+	private:
+		static_assert(Size <= UINT32_MAX, "The size must fit in 32 bits, since it shares an atomic with the allocation count");
+
+		// The lower 32 bits hold the offset, while the upper 32 bits hold the number of live allocations
+		static constexpr uint64_t OFFSET_MASK = 0xFFFFFFFF;
+		static constexpr uint64_t COUNT_ONE = uint64_t(1) << 32;
+
+	public:
+		atomic_linear_allocator() noexcept :
+			m_Data{},
+			m_State(0) {}
+
+		atomic_linear_allocator(const atomic_linear_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @note Moving is only allowed if the original allocator has no allocations
+		 * @param other The original allocator
+		*/
+		atomic_linear_allocator(atomic_linear_allocator&& other) noexcept :
+			m_Data{},
+			m_State(0)
+		{
+			// Moving raw allocators in use is undefined
+			KTL_ASSERT(other.m_State.load(std::memory_order_relaxed) == 0);
+		}
+
+		atomic_linear_allocator& operator=(const atomic_linear_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move assignment operator
+		 * @note Moving is only allowed if the original allocator has no allocations
+		 * @param rhs The original allocator
+		*/
+		atomic_linear_allocator& operator=(atomic_linear_allocator&& rhs) noexcept
+		{
+			m_State.store(0, std::memory_order_relaxed);
+
+			// Moving raw allocators in use is undefined
+			KTL_ASSERT(rhs.m_State.load(std::memory_order_relaxed) == 0);
+
+			return *this;
+		}
+
+		bool operator==(const atomic_linear_allocator& rhs) const noexcept
+		{
+			return this == &rhs;
+		}
+
+		bool operator!=(const atomic_linear_allocator& rhs) const noexcept
+		{
+			return this != &rhs;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			if (totalSize > Size)
+				return nullptr;
+
+			uint64_t state = m_State.load(std::memory_order_relaxed);
+			uint64_t offset;
+
+			do
+			{
+				offset = state & OFFSET_MASK;
+
+				if (offset + totalSize > Size)
+					return nullptr;
+			} while (!m_State.compare_exchange_weak(state, state + COUNT_ONE + totalSize, std::memory_order_acquire, std::memory_order_relaxed));
+
+			return m_Data + offset;
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @note The memory is only completely deallocated if it was the last allocation made or all memory has been deallocated
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			uint64_t position = uint64_t(static_cast<char*>(p) - m_Data);
+
+			uint64_t state = m_State.load(std::memory_order_relaxed);
+			uint64_t next;
+
+			do
+			{
+				KTL_ASSERT(state >= COUNT_ONE);
+
+				uint64_t count = (state >> 32) - 1;
+				uint64_t offset = state & OFFSET_MASK;
+
+				// Reclaim everything once the last allocation is gone, or just this one if it was the last made
+				if (count == 0)
+					offset = 0;
+				else if (offset - totalSize == position)
+					offset = position;
+
+				next = (count << 32) | offset;
+			} while (!m_State.compare_exchange_weak(state, next, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made can be resized
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			size_t newSize = new_n + detail::align_to_architecture(new_n);
+			uint64_t position = uint64_t(static_cast<char*>(p) - m_Data);
+
+			uint64_t state = m_State.load(std::memory_order_relaxed);
+
+			do
+			{
+				uint64_t offset = state & OFFSET_MASK;
+
+				if (offset - totalSize != position)
+					return false;
+
+				if (position + newSize > Size)
+					return false;
+			} while (!m_State.compare_exchange_weak(state, (state & ~OFFSET_MASK) | (position + newSize), std::memory_order_acquire, std::memory_order_relaxed));
+
+			return true;
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Returns whether or not the allocator owns the given location in memory
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+			uintptr_t low = reinterpret_cast<uintptr_t>(m_Data);
+			uintptr_t high = low + Size;
+
+			return ptr >= low && ptr < high;
+		}
+#pragma endregion
+
+	private:
+		alignas(detail::ALIGNMENT) char m_Data[Size];
+		std::atomic<uint64_t> m_State;
+	};
+}
\ No newline at end of file
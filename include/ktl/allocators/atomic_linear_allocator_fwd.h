@@ -0,0 +1,32 @@
+#pragma once
+
+#include "reference_fwd.h"
+#include "shared_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// atomic_linear_allocator
+	template<size_t Size>
+	class atomic_linear_allocator;
+
+	/**
+	 * @brief Shorthand for a typed atomic linear allocator
+	*/
+	template<typename T, size_t Size>
+	using type_atomic_linear_allocator = type_allocator<T, atomic_linear_allocator<Size>>;
+
+	/**
+	 * @brief Shorthand for a typed, weak-reference atomic linear allocator
+	*/
+	template<typename T, size_t Size>
+	using type_reference_atomic_linear_allocator = type_allocator<T, reference<atomic_linear_allocator<Size>>>;
+
+	/**
+	 * @brief Shorthand for a typed, atomic-ref-counted atomic linear allocator
+	*/
+	template<typename T, size_t Size>
+	using type_shared_atomic_linear_allocator = type_allocator<T, atomic_shared<atomic_linear_allocator<Size>>>;
+}
\ No newline at end of file
@@ -133,19 +133,30 @@ namespace ktl
 		*/
 		void deallocate(void* p, size_type n) noexcept(
 			std::is_nothrow_destructible_v<node> &&
-			detail::has_nothrow_owns_v<Alloc> &&
-			detail::has_nothrow_deallocate_v<Alloc>)
+			detail::has_nothrow_try_deallocate_v<Alloc>)
 		{
 			KTL_ASSERT(p != nullptr);
 
+			try_deallocate(p, n);
+		}
+
+		/**
+		 * @brief Deallocates the memory at location @p p, if any of the allocator instances owns it
+		 * @note Ownership is resolved once per instance, while traversing them
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		 * @return Whether the memory was owned and deallocated
+		*/
+		bool try_deallocate(void* p, size_type n) noexcept(
+			std::is_nothrow_destructible_v<node> &&
+			detail::has_nothrow_try_deallocate_v<Alloc>)
+		{
 			node* prev = nullptr;
 			node* next = m_Node;
 			while (next)
 			{
-				if (next->Allocator.owns(p))
+				if (detail::try_deallocate(next->Allocator, p, n))
 				{
-					next->Allocator.deallocate(p, n);
-
 					// If this allocator holds no allocations then delete it
 					// Unless it's the main one, in which case keep it
 					if (--next->Allocations == 0 && prev)
@@ -155,12 +166,14 @@ namespace ktl
 						detail::aligned_delete(next);
 					}
 
-					break;
+					return true;
 				}
 
 				prev = next;
 				next = next->Next;
 			}
+
+			return false;
 		}
 #pragma endregion
 
@@ -259,6 +272,53 @@ namespace ktl
 
 			return false;
 		}
+
+		/**
+		 * @brief Deletes the first allocator instance if it holds no allocations, and trims the rest
+		 * @note Other empty instances are already deleted when their last allocation is deallocated
+		*/
+		void trim() noexcept(
+			std::is_nothrow_destructible_v<node> &&
+			(!detail::has_trim_v<Alloc> || detail::has_nothrow_trim_v<Alloc>))
+		{
+			if (m_Node && m_Node->Allocations == 0)
+			{
+				node* current = m_Node;
+
+				m_Node = current->Next;
+
+				detail::aligned_delete(current);
+			}
+
+			if constexpr (detail::has_trim_v<Alloc>)
+			{
+				node* next = m_Node;
+				while (next)
+				{
+					next->Allocator.trim();
+
+					next = next->Next;
+				}
+			}
+		}
+
+		/**
+		 * @brief Creates the first allocator instance up front, and forwards @p n to it if it defines reserve()
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether the memory could be reserved
+		*/
+		bool reserve(size_type n) noexcept(
+			std::is_nothrow_default_constructible_v<node> &&
+			(!detail::has_reserve_v<Alloc> || detail::has_nothrow_reserve_v<Alloc>))
+		{
+			if (!m_Node)
+				m_Node = detail::aligned_new<node>(detail::ALIGNMENT);
+
+			if constexpr (detail::has_reserve_v<Alloc>)
+				return m_Node->Allocator.reserve(n);
+			else
+				return true;
+		}
 #pragma endregion
 
 	private:
@@ -149,6 +149,32 @@ namespace ktl
 		{
 			return m_Alloc.owns(p);
 		}
+
+		/**
+		 * @brief Returns any memory cached by the underlying allocator to its parent, or the OS
+		 * @note Only defined if the underlying allocator defines it
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			m_Alloc.trim();
+		}
+
+		/**
+		 * @brief Prepares the underlying allocator to serve @p n bytes without going to its parent, or the OS
+		 * @note Only defined if the underlying allocator defines it
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether the memory could be reserved
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return m_Alloc.reserve(n);
+		}
 #pragma endregion
 
 		/**
@@ -0,0 +1,414 @@
+#pragma once
+
+#include "../utility/aligned_malloc.h"
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/source_location.h"
+#include "deferred_fwd.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief An allocator which defers deallocations until no reader can observe the memory anymore.
+	 * Readers mark their critical sections with enter() and exit(), which pins them to the current epoch.
+	 * Deallocations are queued in the epoch they were made in and are released to the underlying allocator in batches,
+	 * once every reader has moved past that epoch.
+	 * @note Allocation and deallocation lock a mutex, while enter() and exit() are lock-free.
+	 * The memory being deallocated is never written to until it is released, so readers can safely keep reading it.
+	 * @tparam Alloc The allocator to wrap around
+	 * @tparam Slots The maximum number of readers that can be inside a critical section at the same time
+	*/
+	template<typename Alloc, size_t Slots>
+	class deferred
+	{
+	private:
+		static_assert(detail::has_no_value_type_v<Alloc>, "Building on top of typed allocators is not allowed. Use allocators without a type");
+		static_assert(Slots > 0, "The deferred allocator requires at least 1 reader slot");
+
+	public:
+		typedef typename detail::get_size_type_t<Alloc> size_type;
+
+	private:
+		// Deallocations from epoch E can be released once the global epoch reaches E + 2
+		static constexpr size_t EPOCHS = 3;
+		static constexpr size_t BATCH_SIZE = 64;
+		static constexpr size_t CACHE_LINE = 64;
+
+		struct retired
+		{
+			void* Pointer;
+			size_type Size;
+		};
+
+		struct batch
+		{
+			retired Entries[BATCH_SIZE];
+			size_t Count = 0;
+			batch* Next = nullptr;
+		};
+
+		// Padded to a cache line to avoid false sharing between readers
+		struct slot
+		{
+			std::atomic<size_t> Epoch{ 0 };
+			char Padding[CACHE_LINE - sizeof(std::atomic<size_t>)];
+		};
+
+	public:
+		/**
+		 * @brief A scoped guard which keeps the reader inside a critical section for its lifetime
+		*/
+		class guard
+		{
+		public:
+			explicit guard(deferred& alloc) noexcept :
+				m_Alloc(&alloc),
+				m_Slot(alloc.enter()) {}
+
+			guard(const guard&) = delete;
+
+			guard& operator=(const guard&) = delete;
+
+			~guard()
+			{
+				m_Alloc->exit(m_Slot);
+			}
+
+		private:
+			deferred* m_Alloc;
+			size_t m_Slot;
+		};
+
+		template<typename A = Alloc>
+		deferred()
+			noexcept(std::is_nothrow_default_constructible_v<Alloc>) :
+			m_Alloc(),
+			m_Lock(),
+			m_Epoch(0),
+			m_Readers{},
+			m_Retired{},
+			m_Spare(nullptr),
+			m_Pending(0) {}
+
+		/**
+		 * @brief Constructor for forwarding any arguments to the underlying allocator
+		*/
+		template<typename... Args,
+			typename = std::enable_if_t<
+			std::is_constructible_v<Alloc, Args...>>>
+		explicit deferred(Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Alloc, Args...>) :
+			m_Alloc(std::forward<Args>(args)...),
+			m_Lock(),
+			m_Epoch(0),
+			m_Readers{},
+			m_Retired{},
+			m_Spare(nullptr),
+			m_Pending(0) {}
+
+		deferred(const deferred&) = delete;
+		deferred(deferred&&) = delete;
+
+		~deferred()
+		{
+			// Destroying the allocator while readers are still inside a critical section is undefined
+			for (size_t i = 0; i < Slots; i++)
+				KTL_ASSERT(m_Readers[i].Epoch.load(std::memory_order_relaxed) == 0);
+
+			for (size_t i = 0; i < EPOCHS; i++)
+				release(i);
+
+			batch* next = m_Spare;
+			while (next)
+			{
+				batch* current = next;
+				next = current->Next;
+				detail::aligned_delete(current);
+			}
+		}
+
+		deferred& operator=(const deferred&) = delete;
+		deferred& operator=(deferred&&) = delete;
+
+		bool operator==(const deferred& rhs) const
+			noexcept(detail::has_nothrow_equal_v<Alloc>)
+		{
+			return m_Alloc == rhs.m_Alloc;
+		}
+
+		bool operator!=(const deferred& rhs) const
+			noexcept(detail::has_nothrow_not_equal_v<Alloc>)
+		{
+			return m_Alloc != rhs.m_Alloc;
+		}
+
+#pragma region Epoch
+		/**
+		 * @brief Enters a critical section, pinning the caller to the current epoch.
+		 * Memory deallocated after this call will not be released until exit() is called.
+		 * @note Spins if all reader slots are currently occupied
+		 * @return The slot that was occupied, which must be passed to exit()
+		*/
+		size_t enter() noexcept
+		{
+			for (size_t i = 0;; i = (i + 1) % Slots)
+			{
+				size_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+				size_t idle = 0;
+
+				if (m_Readers[i].Epoch.compare_exchange_strong(idle, (epoch << 1) | 1, std::memory_order_seq_cst))
+				{
+					// The global epoch may have advanced before we could publish ours
+					size_t current = m_Epoch.load(std::memory_order_seq_cst);
+					while (current != epoch)
+					{
+						epoch = current;
+						m_Readers[i].Epoch.store((epoch << 1) | 1, std::memory_order_seq_cst);
+						current = m_Epoch.load(std::memory_order_seq_cst);
+					}
+
+					return i;
+				}
+			}
+		}
+
+		/**
+		 * @brief Exits a critical section, allowing the memory it observed to be released
+		 * @param slot The slot returned by enter()
+		*/
+		void exit(size_t slot) noexcept
+		{
+			KTL_ASSERT(slot < Slots);
+
+			m_Readers[slot].Epoch.store(0, std::memory_order_release);
+		}
+
+		/**
+		 * @brief Attempts to advance the epoch and release any deallocations that are no longer observable
+		 * @return Whether the epoch could be advanced
+		*/
+		bool collect()
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return try_advance();
+			}
+			catch (const std::system_error&)
+			{
+				return false;
+			}
+		}
+#pragma endregion
+
+#pragma region Allocation
+		void* allocate(size_t n, const source_location source = KTL_SOURCE())
+			noexcept(detail::has_nothrow_allocate_v<Alloc>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return detail::allocate(m_Alloc, n, source);
+			}
+			catch (const std::system_error&)
+			{
+				return nullptr;
+			}
+		}
+
+		/**
+		 * @brief Queues the memory at location @p p for deallocation
+		 * @note The memory is only deallocated once no reader can observe it anymore
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			KTL_ASSERT(p != nullptr);
+
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				size_t index = m_Epoch.load(std::memory_order_relaxed) % EPOCHS;
+
+				batch* current = m_Retired[index];
+				if (!current || current->Count == BATCH_SIZE)
+				{
+					batch* next = m_Spare;
+					if (next)
+						m_Spare = next->Next;
+					else
+						next = detail::aligned_new<batch>(detail::ALIGNMENT);
+
+					next->Count = 0;
+					next->Next = current;
+					m_Retired[index] = next;
+					current = next;
+				}
+
+				current->Entries[current->Count++] = { p, n };
+
+				// Release in batches to amortize scanning the readers
+				if (++m_Pending >= BATCH_SIZE)
+					try_advance();
+			}
+			catch (const std::system_error&) {}
+		}
+#pragma endregion
+
+#pragma region Construction
+		template<typename T, typename... Args>
+		typename std::enable_if<detail::has_construct_v<Alloc, T*, Args...>, void>::type
+		construct(T* p, Args&&... args)
+			noexcept(detail::has_nothrow_construct_v<Alloc, T*, Args...>)
+		{
+			m_Alloc.construct(p, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		typename std::enable_if<detail::has_destroy_v<Alloc, T*>, void>::type
+		destroy(T* p)
+			noexcept(detail::has_nothrow_destroy_v<Alloc, T*>)
+		{
+			m_Alloc.destroy(p);
+		}
+#pragma endregion
+
+#pragma region Utility
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_max_size_v<A>, size_type>::type
+		max_size() const
+			noexcept(detail::has_nothrow_max_size_v<A>)
+		{
+			return m_Alloc.max_size();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_owns_v<A>, bool>::type
+		owns(void* p) const
+			noexcept(detail::has_nothrow_owns_v<A>)
+		{
+			return m_Alloc.owns(p);
+		}
+
+		/**
+		 * @brief Deletes the spare batches used for queueing deallocations and trims the underlying allocator, if it defines it
+		 * @note Deallocations which are still queued are not affected. Call collect() first to release them
+		*/
+		void trim() noexcept(!detail::has_trim_v<Alloc> || detail::has_nothrow_trim_v<Alloc>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				batch* next = m_Spare;
+				while (next)
+				{
+					batch* current = next;
+					next = current->Next;
+					detail::aligned_delete(current);
+				}
+
+				m_Spare = nullptr;
+
+				if constexpr (detail::has_trim_v<Alloc>)
+					m_Alloc.trim();
+			}
+			catch (const std::system_error&) {}
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return m_Alloc.reserve(n);
+			}
+			catch (const std::system_error&)
+			{
+				return false;
+			}
+		}
+#pragma endregion
+
+		Alloc& get_allocator() noexcept
+		{
+			return m_Alloc;
+		}
+
+		const Alloc& get_allocator() const noexcept
+		{
+			return m_Alloc;
+		}
+
+	private:
+		bool try_advance()
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			size_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+			size_t pinned = (epoch << 1) | 1;
+
+			// Every reader must have observed the current epoch before we can move on
+			for (size_t i = 0; i < Slots; i++)
+			{
+				size_t value = m_Readers[i].Epoch.load(std::memory_order_seq_cst);
+				if (value != 0 && value != pinned)
+					return false;
+			}
+
+			m_Epoch.store(epoch + 1, std::memory_order_seq_cst);
+
+			// Anything deallocated 2 epochs ago can no longer be observed
+			release((epoch + 1 + 1) % EPOCHS);
+
+			return true;
+		}
+
+		void release(size_t index)
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			batch* next = m_Retired[index];
+			while (next)
+			{
+				for (size_t i = 0; i < next->Count; i++)
+					m_Alloc.deallocate(next->Entries[i].Pointer, next->Entries[i].Size);
+
+				m_Pending -= next->Count;
+
+				batch* current = next;
+				next = current->Next;
+
+				// Keep the batch around for later deallocations
+				current->Next = m_Spare;
+				m_Spare = current;
+			}
+
+			m_Retired[index] = nullptr;
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+		std::mutex m_Lock;
+		std::atomic<size_t> m_Epoch;
+		slot m_Readers[Slots];
+		batch* m_Retired[EPOCHS];
+		batch* m_Spare;
+		size_t m_Pending;
+	};
+}
\ No newline at end of file
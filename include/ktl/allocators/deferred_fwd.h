@@ -0,0 +1,19 @@
+#pragma once
+
+#include "shared_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// Wrapper class for deferring deallocations until no readers can observe them
+	template<typename Alloc, size_t Slots = 64>
+	class deferred;
+
+	/**
+	 * @brief Shorthand for a typed, ref-counted deferred allocator
+	*/
+	template<typename T, typename Alloc, size_t Slots = 64>
+	using type_shared_deferred = type_allocator<T, atomic_shared<deferred<Alloc, Slots>>>;
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "double_stack_allocator_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A stack object of a given @p Size, which can be allocated from both ends
+	*/
+	template<size_t Size>
+	struct double_stack
+	{
+		alignas(detail::ALIGNMENT) char Data[Size];
+		char* Bottom;
+		char* Top;
+
+		double_stack() noexcept :
+			Data{},
+			Bottom(Data),
+			Top(Data + Size) {}
+	};
+
+	/**
+	 * @brief A linear allocator which gives out chunks from one end of a double_stack.
+	 * An allocator for the bottom and one for the top can share the same double_stack, each growing towards the other,
+	 * so that long-lived and temporary data can share one capacity, instead of needing a fixed budget each.
+	 * Only the last allocation made from an end can be deallocated, but each end can be rewound to an earlier marker.
+	 * @note Cannot be default constructed because it needs a reference to a double_stack
+	 * @tparam Size The size of the double_stack
+	 * @tparam Top Whether to allocate from the top of the stack, rather than the bottom
+	*/
+	template<size_t Size, bool Top>
+	class double_stack_allocator
+	{
+	private:
+		static_assert(Size % detail::ALIGNMENT == 0, "The size must be a multiple of the alignment, so that the top is aligned");
+
+	public:
+		explicit double_stack_allocator(double_stack<Size>& block) noexcept :
+			m_Block(&block) {}
+
+		explicit double_stack_allocator(double_stack<Size>* block) noexcept :
+			m_Block(block) {}
+
+		double_stack_allocator(const double_stack_allocator&) noexcept = default;
+
+		double_stack_allocator(double_stack_allocator&&) noexcept = default;
+
+		double_stack_allocator& operator=(const double_stack_allocator&) noexcept = default;
+
+		double_stack_allocator& operator=(double_stack_allocator&&) noexcept = default;
+
+		bool operator==(const double_stack_allocator& rhs) const noexcept
+		{
+			return m_Block == rhs.m_Block;
+		}
+
+		bool operator!=(const double_stack_allocator& rhs) const noexcept
+		{
+			return m_Block != rhs.m_Block;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n from this end of the stack
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			// Both ends share the space between them
+			if (totalSize > size_t(m_Block->Top - m_Block->Bottom))
+				return nullptr;
+
+			if constexpr (Top)
+			{
+				m_Block->Top -= totalSize;
+
+				return m_Block->Top;
+			}
+			else
+			{
+				char* current = m_Block->Bottom;
+
+				m_Block->Bottom += totalSize;
+
+				return current;
+			}
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @note The memory is only deallocated if it was the last allocation made from this end. Use rewind() to deallocate several at once
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			if constexpr (Top)
+			{
+				if (m_Block->Top == p)
+					m_Block->Top += totalSize;
+			}
+			else
+			{
+				if (m_Block->Bottom - totalSize == p)
+					m_Block->Bottom -= totalSize;
+			}
+		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made from the bottom can be resized, since allocations from the top grow downwards
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			if constexpr (Top)
+			{
+				return false;
+			}
+			else
+			{
+				size_t totalSize = n + detail::align_to_architecture(n);
+				size_t newSize = new_n + detail::align_to_architecture(new_n);
+
+				if (m_Block->Bottom - totalSize != p)
+					return false;
+
+				if (newSize > size_t(m_Block->Top - static_cast<char*>(p)))
+					return false;
+
+				m_Block->Bottom = static_cast<char*>(p) + newSize;
+
+				return true;
+			}
+		}
+#pragma endregion
+
+#pragma region Markers
+		/**
+		 * @brief Returns a marker for the current position of this end of the stack
+		 * @return The amount of bytes allocated from this end
+		*/
+		size_t get_marker() const noexcept
+		{
+			if constexpr (Top)
+				return size_t((m_Block->Data + Size) - m_Block->Top);
+			else
+				return size_t(m_Block->Bottom - m_Block->Data);
+		}
+
+		/**
+		 * @brief Deallocates everything allocated from this end of the stack since @p marker was returned by get_marker()
+		 * @param marker The marker to rewind to. Rewinds the whole end if unspecified
+		*/
+		void rewind(size_t marker = 0) noexcept
+		{
+			KTL_ASSERT(marker <= get_marker());
+
+			if constexpr (Top)
+				m_Block->Top = m_Block->Data + Size - marker;
+			else
+				m_Block->Bottom = m_Block->Data + marker;
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Returns whether or not this end of the stack owns the given location in memory
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			// Comparing pointers to different objects is unspecified
+			// But converting them to integers and comparing them isn't...
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+			uintptr_t low = reinterpret_cast<uintptr_t>(m_Block->Data);
+			uintptr_t high = low + Size;
+
+			if constexpr (Top)
+				low = reinterpret_cast<uintptr_t>(m_Block->Top);
+			else
+				high = reinterpret_cast<uintptr_t>(m_Block->Bottom);
+
+			return ptr >= low && ptr < high;
+		}
+#pragma endregion
+
+	private:
+		double_stack<Size>* m_Block;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "shared_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// double_stack
+	template<size_t Size>
+	struct double_stack;
+
+	// double_stack_allocator
+	template<size_t Size, bool Top = false>
+	class double_stack_allocator;
+
+	/**
+	 * @brief Shorthand for a typed double stack allocator
+	*/
+	template<typename T, size_t Size, bool Top = false>
+	using type_double_stack_allocator = type_allocator<T, double_stack_allocator<Size, Top>>;
+
+	/**
+	 * @brief Shorthand for a typed, ref-counted double stack allocator
+	*/
+	template<typename T, size_t Size, bool Top = false>
+	using type_shared_double_stack_allocator = type_allocator<T, shared<double_stack_allocator<Size, Top>>>;
+}
\ No newline at end of file
@@ -108,16 +108,31 @@ namespace ktl
 		}
 
 		void deallocate(void* p, size_t n)
-			noexcept(detail::has_nothrow_deallocate_v<P>&& detail::has_nothrow_deallocate_v<F>)
+			noexcept(detail::has_nothrow_try_deallocate_v<P>&& detail::has_nothrow_deallocate_v<F>)
 		{
-			if (m_Primary.owns(p))
-			{
-				m_Primary.deallocate(p, n);
+			if (detail::try_deallocate(m_Primary, p, n))
 				return;
-			}
 
 			m_Fallback.deallocate(p, n);
 		}
+
+		/**
+		 * @brief Deallocates the memory at location @p p, if either allocator owns it
+		 * @note Ownership is only resolved once, so nested composites don't have to walk their children twice
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		 * @return Whether the memory was owned and deallocated
+		*/
+		template<typename Fallback = F>
+		typename std::enable_if<detail::has_owns_v<Fallback> || detail::has_try_deallocate_v<Fallback>, bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<P> && detail::has_nothrow_try_deallocate_v<Fallback>)
+		{
+			if (detail::try_deallocate(m_Primary, p, n))
+				return true;
+
+			return detail::try_deallocate(m_Fallback, p, n);
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -201,6 +216,43 @@ namespace ktl
 			
 			return m_Fallback.owns(p);
 		}
+
+		template<typename Primary = P, typename Fallback = F>
+		typename std::enable_if<detail::has_trim_v<Primary> || detail::has_trim_v<Fallback>, void>::type
+		trim() noexcept(
+			(!detail::has_trim_v<Primary> || detail::has_nothrow_trim_v<Primary>) &&
+			(!detail::has_trim_v<Fallback> || detail::has_nothrow_trim_v<Fallback>))
+		{
+			if constexpr (detail::has_trim_v<Primary>)
+				m_Primary.trim();
+
+			if constexpr (detail::has_trim_v<Fallback>)
+				m_Fallback.trim();
+		}
+
+		/**
+		 * @brief Prepares the primary allocator for @p n bytes, and only asks the fallback allocator if the primary allocator couldn't
+		 * @note A primary allocator without a reserve() method can't prepare anything, so the fallback allocator is asked for all @p n bytes
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether either allocator could reserve the memory
+		*/
+		template<typename Primary = P, typename Fallback = F>
+		typename std::enable_if<detail::has_reserve_v<Primary> || detail::has_reserve_v<Fallback>, bool>::type
+		reserve(size_t n) noexcept(
+			(!detail::has_reserve_v<Primary> || detail::has_nothrow_reserve_v<Primary>) &&
+			(!detail::has_reserve_v<Fallback> || detail::has_nothrow_reserve_v<Fallback>))
+		{
+			if constexpr (detail::has_reserve_v<Primary>)
+			{
+				if (m_Primary.reserve(n))
+					return true;
+			}
+
+			if constexpr (detail::has_reserve_v<Fallback>)
+				return m_Fallback.reserve(n);
+			else
+				return false;
+		}
 #pragma endregion
 
 	private:
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "frame_allocator_fwd.h"
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A linear allocator which rotates between multiple internal buffers, one for each frame.
+	 * Memory allocated during a frame stays valid until next_frame() has been called @p Frames times,
+	 * at which point the whole buffer is reused in O(1) time.
+	 * Deallocation is a no-op, so there is no need to deallocate anything at all.
+	 * @tparam Size The size of each frame's buffer, which is also the max allocation size
+	 * @tparam Frames The amount of frames that memory should stay valid for
+	*/
+	template<size_t Size, size_t Frames>
+	class frame_allocator
+	{
+	private:
+		static_assert(Frames > 0, "The frame allocator requires at least 1 frame");
+
+		// Keep every frame's buffer aligned
+		static constexpr size_t STRIDE = Size + detail::align_to_architecture(Size);
+
+	public:
+		frame_allocator() noexcept :
+			m_Data{},
+			m_Free(m_Data[0]),
+			m_Frame(0) {}
+
+		frame_allocator(const frame_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @note Moving does not transfer any allocations, so they are lost
+		 * @param other The original allocator
+		*/
+		frame_allocator(frame_allocator&& other) noexcept :
+			m_Data{},
+			m_Free(m_Data[0]),
+			m_Frame(0) {}
+
+		frame_allocator& operator=(const frame_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move assignment operator
+		 * @note Moving does not transfer any allocations, so they are lost
+		 * @param rhs The original allocator
+		*/
+		frame_allocator& operator=(frame_allocator&& rhs) noexcept
+		{
+			m_Free = m_Data[0];
+			m_Frame = 0;
+
+			return *this;
+		}
+
+		bool operator==(const frame_allocator& rhs) const noexcept
+		{
+			return this == &rhs;
+		}
+
+		bool operator!=(const frame_allocator& rhs) const noexcept
+		{
+			return this != &rhs;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n in the current frame
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			if ((size_t(m_Free - m_Data[m_Frame]) + totalSize) > Size)
+				return nullptr;
+
+			char* current = m_Free;
+
+			m_Free += totalSize;
+
+			return current;
+		}
+
+		/**
+		 * @brief Does nothing, since the memory is released when its frame is reused
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate([[maybe_unused]] void* p, [[maybe_unused]] size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+			KTL_ASSERT(owns(p));
+		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made in the current frame can be resized
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			size_t newSize = new_n + detail::align_to_architecture(new_n);
+
+			if (m_Free - totalSize != p)
+				return false;
+
+			if ((size_t(m_Free - m_Data[m_Frame]) - totalSize + newSize) > Size)
+				return false;
+
+			m_Free = static_cast<char*>(p) + newSize;
+
+			return true;
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Returns whether or not the allocator owns the given location in memory, in any frame
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+			uintptr_t low = reinterpret_cast<uintptr_t>(m_Data);
+			uintptr_t high = low + STRIDE * Frames;
+
+			return ptr >= low && ptr < high;
+		}
+
+		/**
+		 * @brief Advances to the next frame, releasing everything that was allocated @p Frames frames ago
+		*/
+		void next_frame() noexcept
+		{
+			m_Frame = (m_Frame + 1) % Frames;
+			m_Free = m_Data[m_Frame];
+		}
+
+		/**
+		 * @brief Returns the index of the current frame's buffer
+		 * @return A value between 0 and @p Frames
+		*/
+		size_t frame() const noexcept
+		{
+			return m_Frame;
+		}
+#pragma endregion
+
+	private:
+		alignas(detail::ALIGNMENT) char m_Data[Frames][STRIDE];
+		char* m_Free;
+		size_t m_Frame;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "reference_fwd.h"
+#include "shared_fwd.h"
+#include "threaded_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// frame_allocator
+	template<size_t Size, size_t Frames = 2>
+	class frame_allocator;
+
+	/**
+	 * @brief Shorthand for a typed frame allocator
+	*/
+	template<typename T, size_t Size, size_t Frames = 2>
+	using type_frame_allocator = type_allocator<T, frame_allocator<Size, Frames>>;
+
+	/**
+	 * @brief Shorthand for a typed, weak-reference frame allocator
+	*/
+	template<typename T, size_t Size, size_t Frames = 2>
+	using type_reference_frame_allocator = type_allocator<T, reference<frame_allocator<Size, Frames>>>;
+
+	/**
+	 * @brief Shorthand for a typed, ref-counted frame allocator
+	*/
+	template<typename T, size_t Size, size_t Frames = 2>
+	using type_shared_frame_allocator = type_allocator<T, shared<frame_allocator<Size, Frames>>>;
+}
\ No newline at end of file
@@ -206,6 +206,54 @@ namespace ktl
 		{
 			return m_Alloc.owns(p);
 		}
+
+		/**
+		 * @brief Deallocates all memory kept in the linked list, returning it to the underlying allocator
+		 * @note Also trims the underlying allocator, if it defines it
+		*/
+		void trim() noexcept(
+			detail::has_nothrow_deallocate_v<Alloc> &&
+			(!detail::has_trim_v<Alloc> || detail::has_nothrow_trim_v<Alloc>))
+		{
+			release();
+
+			m_Free = nullptr;
+
+			if constexpr (detail::has_trim_v<Alloc>)
+				m_Alloc.trim();
+		}
+
+		/**
+		 * @brief Allocates enough blocks from the underlying allocator to serve @p n bytes, and keeps them in the linked list
+		 * @note Blocks already in the linked list count towards @p n
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether enough blocks could be allocated
+		*/
+		bool reserve(size_type n)
+			noexcept(detail::has_nothrow_allocate_v<Alloc>)
+		{
+			size_type reserved = 0;
+
+			link* next = m_Free;
+			while (next && reserved < n)
+			{
+				reserved += Max;
+				next = next->Next;
+			}
+
+			for (; reserved < n; reserved += Max)
+			{
+				link* block = reinterpret_cast<link*>(detail::allocate(m_Alloc, Max, KTL_SOURCE()));
+
+				if (!block)
+					return false;
+
+				block->Next = m_Free;
+				m_Free = block;
+			}
+
+			return true;
+		}
 #pragma endregion
 
 		/**
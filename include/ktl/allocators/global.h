@@ -12,6 +12,11 @@
 
 namespace ktl
 {
+	/**
+	 * @brief A wrapper class for making an allocator global and shared between all instances.
+	 * The underlying allocator is constructed lazily and is never destroyed.
+	 * @tparam Alloc The allocator to make global
+	*/
 	template<typename Alloc>
 	class global
 	{
@@ -54,13 +59,29 @@ namespace ktl
 		void* allocate(size_t n, const source_location source = KTL_SOURCE())
 			noexcept(detail::has_nothrow_allocate_v<Alloc>)
 		{
-			return detail::allocate(s_Alloc, n, source);
+			return detail::allocate(get_instance(), n, source);
 		}
 
 		void deallocate(void* p, size_t n)
 			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
 		{
-			s_Alloc.deallocate(p, n);
+			get_instance().deallocate(p, n);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_expand_v<A>, bool>::type
+		expand(void* p, size_t n, size_t new_n)
+			noexcept(detail::has_nothrow_expand_v<A>)
+		{
+			return get_instance().expand(p, n, new_n);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_try_deallocate_v<A>, bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<A>)
+		{
+			return get_instance().try_deallocate(p, n);
 		}
 #pragma endregion
 
@@ -70,7 +91,7 @@ namespace ktl
 		construct(T* p, Args&&... args)
 			noexcept(detail::has_nothrow_construct_v<Alloc, T*, Args...>)
 		{
-			s_Alloc.construct(p, std::forward<Args>(args)...);
+			get_instance().construct(p, std::forward<Args>(args)...);
 		}
 
 		template<typename T>
@@ -78,7 +99,7 @@ namespace ktl
 		destroy(T* p)
 			noexcept(detail::has_nothrow_destroy_v<Alloc, T*>)
 		{
-			s_Alloc.destroy(p);
+			get_instance().destroy(p);
 		}
 #pragma endregion
 
@@ -88,7 +109,7 @@ namespace ktl
 		max_size() const
 			noexcept(detail::has_nothrow_max_size_v<A>)
 		{
-			return s_Alloc.max_size();
+			return get_instance().max_size();
 		}
 
 		template<typename A = Alloc>
@@ -96,26 +117,53 @@ namespace ktl
 		owns(void* p) const
 			noexcept(detail::has_nothrow_owns_v<A>)
 		{
-			return s_Alloc.owns(p);
+			return get_instance().owns(p);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			get_instance().trim();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return get_instance().reserve(n);
 		}
 #pragma endregion
 
 		void set_allocator(Alloc&& value) noexcept
 		{
-			s_Alloc = std::move(value);
+			get_instance() = std::move(value);
 		}
 
 		Alloc& get_allocator() noexcept
 		{
-			return s_Alloc;
+			return get_instance();
 		}
 
 		const Alloc& get_allocator() const noexcept
 		{
-			return s_Alloc;
+			return get_instance();
 		}
 
 	private:
-		static inline Alloc s_Alloc{};
+		/**
+		 * @brief Returns the underlying allocator, constructing it on first use.
+		 * It is never destroyed, so it remains usable during static initialization and destruction of other objects.
+		 * @note The underlying allocator must not itself allocate through global operator new when constructed
+		*/
+		static Alloc& get_instance() noexcept
+		{
+			alignas(Alloc) static unsigned char s_Storage[sizeof(Alloc)];
+			static Alloc* s_Alloc = ::new(s_Storage) Alloc();
+
+			return *s_Alloc;
+		}
 	};
 }
\ No newline at end of file
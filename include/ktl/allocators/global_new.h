@@ -0,0 +1,158 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "../utility/meta.h"
+#include "global.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Replaces every global operator new and delete in the program with ktl::global_new<Alloc>.
+ * Must be used at global scope in exactly one translation unit.
+*/
+#define KTL_GLOBAL_NEW(...) \
+	void* operator new(std::size_t n) { return ::ktl::global_new<__VA_ARGS__>::allocate_or_throw(n); } \
+	void* operator new[](std::size_t n) { return ::ktl::global_new<__VA_ARGS__>::allocate_or_throw(n); } \
+	void* operator new(std::size_t n, const std::nothrow_t&) noexcept { return ::ktl::global_new<__VA_ARGS__>::allocate(n); } \
+	void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return ::ktl::global_new<__VA_ARGS__>::allocate(n); } \
+	void* operator new(std::size_t n, std::align_val_t a) { return ::ktl::global_new<__VA_ARGS__>::allocate_or_throw(n, static_cast<std::size_t>(a)); } \
+	void* operator new[](std::size_t n, std::align_val_t a) { return ::ktl::global_new<__VA_ARGS__>::allocate_or_throw(n, static_cast<std::size_t>(a)); } \
+	void* operator new(std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return ::ktl::global_new<__VA_ARGS__>::allocate(n, static_cast<std::size_t>(a)); } \
+	void* operator new[](std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return ::ktl::global_new<__VA_ARGS__>::allocate(n, static_cast<std::size_t>(a)); } \
+	void operator delete(void* p) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete(void* p, std::size_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p, std::size_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete(void* p, const std::nothrow_t&) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p, const std::nothrow_t&) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete(void* p, std::align_val_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p, std::align_val_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete(void* p, std::size_t, std::align_val_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); } \
+	void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { ::ktl::global_new<__VA_ARGS__>::deallocate(p); }
+
+namespace ktl
+{
+	/**
+	 * @brief Backend for replacing the global operator new and delete with a KTL allocator.
+	 * Every allocation is prefixed with a small header, which records its size and alignment offset,
+	 * so that unsized and aligned deletes can be routed back to the allocator they came from.
+	 * If the allocator fails to allocate, the memory is taken from malloc instead and the header remembers that.
+	 * @note Use KTL_GLOBAL_NEW(Alloc) in exactly one translation unit to install the replacement.
+	 * The allocator must be thread-safe, align to detail::ALIGNMENT and must not use operator new itself.
+	 * @tparam Alloc The allocator to route allocations through. It is wrapped in a ktl::global
+	*/
+	template<typename Alloc>
+	class global_new
+	{
+	private:
+		static_assert(detail::has_no_value_type_v<Alloc>, "Building on top of typed allocators is not allowed. Use allocators without a type");
+
+		struct header
+		{
+			size_t Size;
+			uint32_t Offset;
+			uint32_t Fallback;
+		};
+
+		static constexpr size_t HEADER_SIZE = sizeof(header) + detail::align_to_architecture(sizeof(header));
+
+	public:
+		/**
+		 * @brief Allocates @p n bytes aligned to @p alignment, falling back to malloc if the allocator fails
+		 * @param n The amount of bytes to allocate
+		 * @param alignment The alignment of the memory, which must be a power of 2
+		 * @return A pointer to the allocated memory or nullptr if both the allocator and malloc failed
+		*/
+		static void* allocate(size_t n, size_t alignment = detail::ALIGNMENT) noexcept
+		{
+			if (alignment < detail::ALIGNMENT)
+				alignment = detail::ALIGNMENT;
+
+			// Room for the header in front and for aligning beyond what the allocator guarantees
+			size_t total = n + HEADER_SIZE + alignment - detail::ALIGNMENT;
+			if (total < n)
+				return nullptr;
+
+			uint32_t fallback = 0;
+			void* block = nullptr;
+
+			try
+			{
+				block = global<Alloc>().allocate(total);
+			}
+			catch (...) {}
+
+			if (!block)
+			{
+				block = std::malloc(total);
+				fallback = 1;
+
+				if (!block)
+					return nullptr;
+			}
+
+			KTL_ASSERT((reinterpret_cast<uintptr_t>(block) & detail::ALIGNMENT_MASK) == 0);
+
+			uintptr_t address = reinterpret_cast<uintptr_t>(block) + HEADER_SIZE;
+			uintptr_t aligned = (address + alignment - 1) & ~uintptr_t(alignment - 1);
+
+			header* info = reinterpret_cast<header*>(aligned) - 1;
+			info->Size = total;
+			info->Offset = uint32_t(aligned - reinterpret_cast<uintptr_t>(block));
+			info->Fallback = fallback;
+
+			return reinterpret_cast<void*>(aligned);
+		}
+
+		/**
+		 * @brief Allocates like allocate(), but calls the new-handler or throws std::bad_alloc on failure, like operator new
+		*/
+		static void* allocate_or_throw(size_t n, size_t alignment = detail::ALIGNMENT)
+		{
+			while (true)
+			{
+				if (void* p = allocate(n, alignment))
+					return p;
+
+				std::new_handler handler = std::get_new_handler();
+				if (!handler)
+					throw std::bad_alloc();
+
+				handler();
+			}
+		}
+
+		/**
+		 * @brief Deallocates memory returned by allocate(), returning it to whichever allocator it came from
+		 * @param p The location in memory to deallocate. Can be nullptr
+		*/
+		static void deallocate(void* p) noexcept
+		{
+			if (!p)
+				return;
+
+			header* info = static_cast<header*>(p) - 1;
+			void* block = static_cast<char*>(p) - info->Offset;
+
+			if (info->Fallback)
+				std::free(block);
+			else
+				global<Alloc>().deallocate(block, info->Size);
+		}
+
+		/**
+		 * @brief Returns whether the memory at @p p was served by the allocator, rather than malloc
+		 * @param p The location in memory returned by allocate()
+		*/
+		static bool owns(void* p) noexcept
+		{
+			return p && !(static_cast<header*>(p) - 1)->Fallback;
+		}
+	};
+}
\ No newline at end of file
@@ -58,12 +58,12 @@ namespace ktl
 
 		bool operator==(const linear_allocator& rhs) const noexcept
 		{
-			return m_Data == rhs.m_Data;
+			return this == &rhs;
 		}
 
 		bool operator!=(const linear_allocator& rhs) const noexcept
 		{
-			return m_Data != rhs.m_Data;
+			return this != &rhs;
 		}
 
 #pragma region Allocation
@@ -108,6 +108,33 @@ namespace ktl
 			if (m_ObjectCount == 0)
 				m_Free = m_Data;
 		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made can be resized
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			size_t newSize = new_n + detail::align_to_architecture(new_n);
+
+			if (m_Free - totalSize != p)
+				return false;
+
+			if ((size_t(m_Free - m_Data) - totalSize + newSize) > Size)
+				return false;
+
+			m_Free = static_cast<char*>(p) + newSize;
+			m_ObjectCount = m_ObjectCount - totalSize + newSize;
+
+			return true;
+		}
 #pragma endregion
 
 #pragma region Utility
@@ -5,6 +5,10 @@
 #include "mallocator_fwd.h"
 #include "type_allocator.h"
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 namespace ktl
 {
 	/**
@@ -43,7 +47,20 @@ namespace ktl
 
 		void deallocate(void* p, size_t n) noexcept
 		{
-			detail::aligned_free(p);
+			detail::aligned_free(p, n, detail::ALIGNMENT);
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Asks malloc to return any free memory at the top of its heap to the OS
+		 * @note Only has an effect with glibc, where it calls malloc_trim
+		*/
+		void trim() noexcept
+		{
+#if defined(__GLIBC__)
+			malloc_trim(0);
+#endif
 		}
 #pragma endregion
 	};
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "../containers/offset_ptr.h"
+#include "../utility/assert.h"
+#include "../utility/mapped_heap.h"
+#include "../utility/mapped_memory.h"
+#include "mmap_file_allocator_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief A file which is mapped into memory, with a heap inside it that persists between runs.
+	 * Data structures can be built directly in the file using a mmap_file_allocator and found again with get_root() after reopening it,
+	 * without any deserialization. Containers stored in the file must use offset pointers, which type_mmap_file_allocator does by default.
+	 * @note The heap is not crash consistent. If the program dies while modifying it, the file may be left in an inconsistent state
+	*/
+	class mmap_file
+	{
+	public:
+		/**
+		 * @brief Opens or creates the file at @p path and maps it into memory
+		 * @note Check is_open() afterwards to see whether it succeeded
+		 * @param path The path of the file
+		 * @param size The minimum size of the file. An existing file is never shrunk
+		*/
+		mmap_file(const char* path, size_t size) noexcept :
+			m_Data(nullptr),
+			m_Size(size),
+			m_Heap(nullptr)
+		{
+			bool created = false;
+			m_Data = detail::map_file(path, m_Size, created);
+
+			if (created)
+				m_Heap = detail::mapped_heap::create(m_Data, m_Size);
+			else
+				m_Heap = detail::mapped_heap::open(m_Data, m_Size);
+
+			if (m_Data && !m_Heap)
+			{
+				detail::unmap_file(m_Data, m_Size);
+				m_Data = nullptr;
+			}
+		}
+
+		mmap_file(const mmap_file&) = delete;
+
+		mmap_file(mmap_file&& other) noexcept :
+			m_Data(other.m_Data),
+			m_Size(other.m_Size),
+			m_Heap(other.m_Heap)
+		{
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+			other.m_Heap = nullptr;
+		}
+
+		~mmap_file() noexcept
+		{
+			if (m_Data)
+				detail::unmap_file(m_Data, m_Size);
+		}
+
+		mmap_file& operator=(const mmap_file&) = delete;
+
+		mmap_file& operator=(mmap_file&& rhs) noexcept
+		{
+			if (m_Data)
+				detail::unmap_file(m_Data, m_Size);
+
+			m_Data = rhs.m_Data;
+			m_Size = rhs.m_Size;
+			m_Heap = rhs.m_Heap;
+
+			rhs.m_Data = nullptr;
+			rhs.m_Size = 0;
+			rhs.m_Heap = nullptr;
+
+			return *this;
+		}
+
+		/**
+		 * @brief Returns whether the file was opened and contains a valid heap
+		*/
+		bool is_open() const noexcept
+		{
+			return m_Heap != nullptr;
+		}
+
+		/**
+		 * @brief Returns the size of the mapped file in bytes
+		*/
+		size_t size() const noexcept
+		{
+			return m_Size;
+		}
+
+		/**
+		 * @brief Returns an allocator which allocates from the heap inside the file
+		*/
+		mmap_file_allocator get_allocator() const noexcept;
+
+		/**
+		 * @brief Returns a root object of the file, which is the entry point to any data stored in it
+		 * @param name The name the object was published under. Unnamed if unspecified
+		 * @return The root object or nullptr if nothing has been published under that name
+		*/
+		template<typename T>
+		T* get_root(const char* name = "") const noexcept
+		{
+			KTL_ASSERT(m_Heap);
+
+			return static_cast<T*>(m_Heap->get_root(name));
+		}
+
+		/**
+		 * @brief Sets the unnamed root object of the file
+		 * @param p The root object, which must be allocated from this file. Passing nullptr removes it
+		*/
+		void set_root(void* p) noexcept
+		{
+			set_root("", p);
+		}
+
+		/**
+		 * @brief Publishes a root object of the file under @p name
+		 * @param name The name of the root, which must be shorter than 32 characters
+		 * @param p The root object, which must be allocated from this file. Passing nullptr removes it
+		 * @return Whether the root could be published. Up to 16 roots can be published
+		*/
+		bool set_root(const char* name, void* p) noexcept
+		{
+			KTL_ASSERT(m_Heap);
+
+			return m_Heap->set_root(name, p);
+		}
+
+		/**
+		 * @brief Writes any changes back to the file on disk
+		 * @return Whether the changes could be written
+		*/
+		bool flush() noexcept
+		{
+			return m_Data && detail::flush_file(m_Data, m_Size);
+		}
+
+	private:
+		void* m_Data;
+		size_t m_Size;
+		detail::mapped_heap* m_Heap;
+	};
+
+	/**
+	 * @brief An allocator which allocates from the heap inside a mmap_file.
+	 * It only stores an offset to the heap, so it can be stored in the file alongside the containers that use it.
+	 * @note Copies all refer to the same heap. A default constructed allocator has no heap and fails every allocation
+	*/
+	class mmap_file_allocator
+	{
+	public:
+		// Pointers stored in the file must be relative, since it may be mapped at a different address next time
+		template<typename T>
+		using pointer_type = offset_ptr<T>;
+
+		mmap_file_allocator() noexcept :
+			m_Heap() {}
+
+		explicit mmap_file_allocator(detail::mapped_heap* heap) noexcept :
+			m_Heap(heap) {}
+
+		mmap_file_allocator(const mmap_file_allocator&) noexcept = default;
+
+		mmap_file_allocator& operator=(const mmap_file_allocator&) noexcept = default;
+
+		bool operator==(const mmap_file_allocator& rhs) const noexcept
+		{
+			return m_Heap.get() == rhs.m_Heap.get();
+		}
+
+		bool operator!=(const mmap_file_allocator& rhs) const noexcept
+		{
+			return m_Heap.get() != rhs.m_Heap.get();
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n
+		 * @note The size is rounded up to the nearest power of 2
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			if (!m_Heap)
+				return nullptr;
+
+			return m_Heap->allocate(n);
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+			KTL_ASSERT(m_Heap);
+
+			m_Heap->deallocate(p, n);
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return m_Heap ? m_Heap->max_size() : 0;
+		}
+
+		/**
+		 * @brief Returns whether or not the allocator owns the given location in memory
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			return m_Heap && m_Heap->owns(p);
+		}
+#pragma endregion
+
+	private:
+		offset_ptr<detail::mapped_heap> m_Heap;
+	};
+
+	inline mmap_file_allocator mmap_file::get_allocator() const noexcept
+	{
+		return mmap_file_allocator(m_Heap);
+	}
+}
\ No newline at end of file
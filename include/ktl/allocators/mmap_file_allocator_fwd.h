@@ -0,0 +1,18 @@
+#pragma once
+
+#include "type_allocator_fwd.h"
+
+namespace ktl
+{
+	// A memory-mapped file, which owns the mapping
+	class mmap_file;
+
+	// mmap_file_allocator
+	class mmap_file_allocator;
+
+	/**
+	 * @brief Shorthand for a typed allocator in a memory-mapped file
+	*/
+	template<typename T>
+	using type_mmap_file_allocator = type_allocator<T, mmap_file_allocator>;
+}
\ No newline at end of file
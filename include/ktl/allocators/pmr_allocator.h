@@ -0,0 +1,189 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/source_location.h"
+#include "pmr_allocator_fwd.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief An allocator which forwards all allocations to a std::pmr::memory_resource.
+	 * Allows any memory resource, like std::pmr::monotonic_buffer_resource, to be used with KTL composites and containers.
+	 * @note Like a reference, it does not own the resource, so the resource should outlive it.
+	*/
+	class pmr_allocator
+	{
+	public:
+		/**
+		 * @brief Constructs the allocator using the current default resource
+		*/
+		pmr_allocator() noexcept :
+			m_Resource(std::pmr::get_default_resource()) {}
+
+		/**
+		 * @brief Constructs the allocator using the given resource
+		 * @param resource The resource to forward allocations to
+		*/
+		explicit pmr_allocator(std::pmr::memory_resource* resource) noexcept :
+			m_Resource(resource)
+		{
+			KTL_ASSERT(resource != nullptr);
+		}
+
+		pmr_allocator(const pmr_allocator&) noexcept = default;
+
+		pmr_allocator(pmr_allocator&&) noexcept = default;
+
+		pmr_allocator& operator=(const pmr_allocator&) noexcept = default;
+
+		pmr_allocator& operator=(pmr_allocator&&) noexcept = default;
+
+		bool operator==(const pmr_allocator& rhs) const noexcept
+		{
+			return m_Resource == rhs.m_Resource || m_Resource->is_equal(*rhs.m_Resource);
+		}
+
+		bool operator!=(const pmr_allocator& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			try
+			{
+				return m_Resource->allocate(n, detail::ALIGNMENT);
+			}
+			catch (const std::bad_alloc&)
+			{
+				return nullptr;
+			}
+		}
+
+		void deallocate(void* p, size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			m_Resource->deallocate(p, n, detail::ALIGNMENT);
+		}
+#pragma endregion
+
+		std::pmr::memory_resource* get_resource() const noexcept
+		{
+			return m_Resource;
+		}
+
+	private:
+		std::pmr::memory_resource* m_Resource;
+	};
+
+	/**
+	 * @brief A std::pmr::memory_resource which allocates using the given allocator.
+	 * Allows any untyped allocator to back std::pmr containers, like std::pmr::vector or std::pmr::unordered_map.
+	 * @note Alignments larger than what the allocator guarantees are handled by over-allocating.
+	 * Throws std::bad_alloc if the allocator returns nullptr, as required by the memory_resource interface.
+	 * @tparam Alloc The allocator to wrap around
+	*/
+	template<typename Alloc>
+	class pmr_resource : public std::pmr::memory_resource
+	{
+	private:
+		static_assert(detail::has_no_value_type_v<Alloc>, "Building on top of typed allocators is not allowed. Use allocators without a type");
+
+	public:
+		template<typename A = Alloc>
+		pmr_resource()
+			noexcept(std::is_nothrow_default_constructible_v<Alloc>) :
+			m_Alloc() {}
+
+		/**
+		 * @brief Constructor for forwarding any arguments to the underlying allocator
+		*/
+		template<typename... Args,
+			typename = std::enable_if_t<
+			std::is_constructible_v<Alloc, Args...>>>
+		explicit pmr_resource(Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Alloc, Args...>) :
+			m_Alloc(std::forward<Args>(args)...) {}
+
+		// Memory resources are referenced by pointer, so they can't be copied
+		pmr_resource(const pmr_resource&) = delete;
+
+		pmr_resource& operator=(const pmr_resource&) = delete;
+
+		Alloc& get_allocator() noexcept
+		{
+			return m_Alloc;
+		}
+
+		const Alloc& get_allocator() const noexcept
+		{
+			return m_Alloc;
+		}
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override
+		{
+			void* p;
+			if (alignment <= detail::ALIGNMENT)
+			{
+				p = detail::allocate(m_Alloc, bytes, KTL_SOURCE());
+			}
+			else
+			{
+				// Over-allocate and store the original pointer right before the aligned one
+				void* block = detail::allocate(m_Alloc, bytes + alignment, KTL_SOURCE());
+				p = block;
+
+				if (block)
+				{
+					uintptr_t address = reinterpret_cast<uintptr_t>(block) + sizeof(void*);
+					uintptr_t aligned = (address + alignment - 1) & ~uintptr_t(alignment - 1);
+
+					p = reinterpret_cast<void*>(aligned);
+					*(reinterpret_cast<void**>(p) - 1) = block;
+				}
+			}
+
+			if (!p)
+				throw std::bad_alloc();
+
+			return p;
+		}
+
+		void do_deallocate(void* p, size_t bytes, size_t alignment) override
+		{
+			if (alignment <= detail::ALIGNMENT)
+				m_Alloc.deallocate(p, bytes);
+			else
+				m_Alloc.deallocate(*(reinterpret_cast<void**>(p) - 1), bytes + alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			if (this == &other)
+				return true;
+
+			const pmr_resource* rhs = dynamic_cast<const pmr_resource*>(&other);
+
+			return rhs && m_Alloc == rhs->m_Alloc;
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// Raw allocator which forwards to a std::pmr::memory_resource
+	class pmr_allocator;
+
+	// Wrapper class for using an allocator as a std::pmr::memory_resource
+	template<typename Alloc>
+	class pmr_resource;
+
+	/**
+	 * @brief Shorthand for a typed allocator which forwards to a std::pmr::memory_resource
+	*/
+	template<typename T>
+	using type_pmr_allocator = type_allocator<T, pmr_allocator>;
+}
\ No newline at end of file
@@ -71,6 +71,22 @@ namespace ktl
 		{
 			m_Alloc->deallocate(p, n);
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_expand_v<A>, bool>::type
+		expand(void* p, size_t n, size_t new_n)
+			noexcept(detail::has_nothrow_expand_v<A>)
+		{
+			return m_Alloc->expand(p, n, new_n);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_try_deallocate_v<A>, bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<A>)
+		{
+			return m_Alloc->try_deallocate(p, n);
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -107,6 +123,22 @@ namespace ktl
 		{
 			return m_Alloc->owns(p);
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			m_Alloc->trim();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return m_Alloc->reserve(n);
+		}
 #pragma endregion
 
 		Alloc& get_allocator() noexcept
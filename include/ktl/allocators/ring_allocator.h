@@ -0,0 +1,268 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "ring_allocator_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A ring buffer allocator which gives out chunks of its internal buffer from the head and reclaims them from the tail.
+	 * Allocating simply increments the head, like a linear_allocator, wrapping around to the start of the buffer when it reaches the end.
+	 * Each allocation has a small header in front of it, which marks it as free when it is deallocated.
+	 * The tail then moves past any free allocations, so memory that is deallocated out of order is reclaimed once everything older than it has been too.
+	 * Useful for streaming data, where allocations are deallocated in roughly the order they were made.
+	 * @tparam Size The size of the internal buffer, including the headers
+	*/
+	template<size_t Size>
+	class ring_allocator
+	{
+	private:
+		struct header
+		{
+			size_t Length;
+			size_t Free;
+		};
+
+		static constexpr size_t HEADER_SIZE = sizeof(header) + detail::align_to_architecture(sizeof(header));
+
+		static_assert(Size > HEADER_SIZE, "The buffer must be large enough to fit at least 1 allocation");
+
+	public:
+		ring_allocator() noexcept :
+			m_Data{},
+			m_Head(0),
+			m_Tail(0),
+			m_Wrap(0),
+			m_Count(0),
+			m_Wrapped(false) {}
+
+		ring_allocator(const ring_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @note Moving is only allowed if the original allocator has no allocations
+		 * @param other The original allocator
+		*/
+		ring_allocator(ring_allocator&& other) noexcept :
+			m_Data{},
+			m_Head(0),
+			m_Tail(0),
+			m_Wrap(0),
+			m_Count(0),
+			m_Wrapped(false)
+		{
+			// Moving raw allocators in use is undefined
+			KTL_ASSERT(other.m_Count == 0);
+		}
+
+		ring_allocator& operator=(const ring_allocator&) noexcept = delete;
+
+		/**
+		 * @brief Move assignment operator
+		 * @note Moving is only allowed if the original allocator has no allocations
+		 * @param rhs The original allocator
+		*/
+		ring_allocator& operator=(ring_allocator&& rhs) noexcept
+		{
+			reset();
+
+			// Moving raw allocators in use is undefined
+			KTL_ASSERT(rhs.m_Count == 0);
+
+			return *this;
+		}
+
+		bool operator==(const ring_allocator& rhs) const noexcept
+		{
+			return this == &rhs;
+		}
+
+		bool operator!=(const ring_allocator& rhs) const noexcept
+		{
+			return this != &rhs;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			if (n > Size)
+				return nullptr;
+
+			size_t totalSize = HEADER_SIZE + n + detail::align_to_architecture(n);
+
+			size_t offset = m_Head;
+			if (m_Wrapped)
+			{
+				// Only the gap between the head and the tail is free
+				if (totalSize > m_Tail - m_Head)
+					return nullptr;
+			}
+			else if (totalSize > Size - m_Head)
+			{
+				// Wrap around to the start, if the oldest allocations have been reclaimed
+				if (totalSize > m_Tail)
+					return nullptr;
+
+				m_Wrap = m_Head;
+				m_Wrapped = true;
+				offset = 0;
+			}
+
+			header* block = reinterpret_cast<header*>(m_Data + offset);
+			block->Length = totalSize;
+			block->Free = 0;
+
+			m_Head = offset + totalSize;
+			m_Count++;
+
+			return m_Data + offset + HEADER_SIZE;
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @note The memory is only reclaimed once every allocation made before it has been deallocated as well
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, [[maybe_unused]] size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+			KTL_ASSERT(owns(p));
+
+			header* block = reinterpret_cast<header*>(static_cast<char*>(p) - HEADER_SIZE);
+
+			KTL_ASSERT(!block->Free);
+			KTL_ASSERT(block->Length == HEADER_SIZE + n + detail::align_to_architecture(n));
+
+			block->Free = 1;
+
+			reclaim();
+		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made can be resized
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, [[maybe_unused]] size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			if (new_n > Size)
+				return false;
+
+			header* block = reinterpret_cast<header*>(static_cast<char*>(p) - HEADER_SIZE);
+
+			KTL_ASSERT(block->Length == HEADER_SIZE + n + detail::align_to_architecture(n));
+
+			size_t offset = size_t(reinterpret_cast<char*>(block) - m_Data);
+			size_t newSize = HEADER_SIZE + new_n + detail::align_to_architecture(new_n);
+
+			if (offset + block->Length != m_Head)
+				return false;
+
+			size_t limit = m_Wrapped ? m_Tail : Size;
+			if (newSize > limit - offset)
+				return false;
+
+			block->Length = newSize;
+			m_Head = offset + newSize;
+
+			return true;
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return Size - HEADER_SIZE;
+		}
+
+		/**
+		 * @brief Returns whether or not the allocator owns the given location in memory
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+			uintptr_t low = reinterpret_cast<uintptr_t>(m_Data);
+			uintptr_t high = low + Size;
+
+			return ptr >= low && ptr < high;
+		}
+
+		/**
+		 * @brief Returns the amount of memory between the tail and the head, including allocations that are waiting to be reclaimed
+		 * @return The amount of bytes in use
+		*/
+		size_t used() const noexcept
+		{
+			if (m_Wrapped)
+				return (m_Wrap - m_Tail) + m_Head;
+
+			return m_Head - m_Tail;
+		}
+#pragma endregion
+
+	private:
+		void reset() noexcept
+		{
+			m_Head = 0;
+			m_Tail = 0;
+			m_Wrap = 0;
+			m_Count = 0;
+			m_Wrapped = false;
+		}
+
+		void reclaim() noexcept
+		{
+			// Move the tail past any allocations that have been deallocated
+			while (m_Count > 0)
+			{
+				if (m_Wrapped && m_Tail == m_Wrap)
+				{
+					m_Tail = 0;
+					m_Wrapped = false;
+					continue;
+				}
+
+				header* block = reinterpret_cast<header*>(m_Data + m_Tail);
+				if (!block->Free)
+					break;
+
+				m_Tail += block->Length;
+				m_Count--;
+			}
+
+			// Start from the beginning when empty, to avoid wrapping
+			if (m_Count == 0)
+				reset();
+		}
+
+	private:
+		alignas(detail::ALIGNMENT) char m_Data[Size];
+		size_t m_Head;
+		size_t m_Tail;
+		size_t m_Wrap;
+		size_t m_Count;
+		bool m_Wrapped;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "reference_fwd.h"
+#include "shared_fwd.h"
+#include "threaded_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// ring_allocator
+	template<size_t Size>
+	class ring_allocator;
+
+	/**
+	 * @brief Shorthand for a typed ring allocator
+	*/
+	template<typename T, size_t Size>
+	using type_ring_allocator = type_allocator<T, ring_allocator<Size>>;
+
+	/**
+	 * @brief Shorthand for a typed, weak-reference ring allocator
+	*/
+	template<typename T, size_t Size>
+	using type_reference_ring_allocator = type_allocator<T, reference<ring_allocator<Size>>>;
+
+	/**
+	 * @brief Shorthand for a typed, ref-counted ring allocator
+	*/
+	template<typename T, size_t Size>
+	using type_shared_ring_allocator = type_allocator<T, shared<ring_allocator<Size>>>;
+}
\ No newline at end of file
@@ -112,6 +112,25 @@ namespace ktl
 			else
 				return m_Fallback.deallocate(p, n);
 		}
+
+		/**
+		 * @brief Deallocates the memory at location @p p, if the allocator chosen by @p n owns it
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		 * @return Whether the memory was owned and deallocated
+		*/
+		template<typename Primary = P, typename Fallback = F>
+		typename std::enable_if<
+			(detail::has_owns_v<Primary> || detail::has_try_deallocate_v<Primary>) &&
+			(detail::has_owns_v<Fallback> || detail::has_try_deallocate_v<Fallback>), bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<Primary> && detail::has_nothrow_try_deallocate_v<Fallback>)
+		{
+			if (n <= Threshold)
+				return detail::try_deallocate(m_Primary, p, n);
+			else
+				return detail::try_deallocate(m_Fallback, p, n);
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -122,27 +141,38 @@ namespace ktl
 			(!detail::has_construct_v<F, T*, Args...> || detail::has_nothrow_construct_v<F, T*, Args...>) &&
 			std::is_nothrow_constructible_v<T, Args...>)
 		{
-			bool owned = m_Primary.owns(p);
-
-			if constexpr (detail::has_construct_v<P, T*, Args...>)
+			// Any block big enough to hold a T must have come from the fallback allocator
+			if constexpr (sizeof(T) > Threshold)
+			{
+				if constexpr (detail::has_construct_v<F, T*, Args...>)
+					m_Fallback.construct(p, std::forward<Args>(args)...);
+				else
+					::new(p) T(std::forward<Args>(args)...);
+			}
+			else
 			{
-				if (owned)
+				bool owned = m_Primary.owns(p);
+
+				if constexpr (detail::has_construct_v<P, T*, Args...>)
 				{
-					m_Primary.construct(p, std::forward<Args>(args)...);
-					return;
+					if (owned)
+					{
+						m_Primary.construct(p, std::forward<Args>(args)...);
+						return;
+					}
 				}
-			}
 
-			if constexpr (detail::has_construct_v<F, T*, Args...>)
-			{
-				if (!owned)
+				if constexpr (detail::has_construct_v<F, T*, Args...>)
 				{
-					m_Fallback.construct(p, std::forward<Args>(args)...);
-					return;
+					if (!owned)
+					{
+						m_Fallback.construct(p, std::forward<Args>(args)...);
+						return;
+					}
 				}
-			}
 
-			::new(p) T(std::forward<Args>(args)...);
+				::new(p) T(std::forward<Args>(args)...);
+			}
 		}
 
 		template<typename T>
@@ -152,27 +182,38 @@ namespace ktl
 			(!detail::has_destroy_v<F, T*> || detail::has_nothrow_destroy_v<F, T*>) &&
 			std::is_nothrow_destructible_v<T>)
 		{
-			bool owned = m_Primary.owns(p);
-
-			if constexpr (detail::has_destroy_v<P, T*>)
+			// Any block big enough to hold a T must have come from the fallback allocator
+			if constexpr (sizeof(T) > Threshold)
+			{
+				if constexpr (detail::has_destroy_v<F, T*>)
+					m_Fallback.destroy(p);
+				else
+					p->~T();
+			}
+			else
 			{
-				if (owned)
+				bool owned = m_Primary.owns(p);
+
+				if constexpr (detail::has_destroy_v<P, T*>)
 				{
-					m_Primary.destroy(p);
-					return;
+					if (owned)
+					{
+						m_Primary.destroy(p);
+						return;
+					}
 				}
-			}
 
-			if constexpr (detail::has_destroy_v<F, T*>)
-			{
-				if (!owned)
+				if constexpr (detail::has_destroy_v<F, T*>)
 				{
-					m_Fallback.destroy(p);
-					return;
+					if (!owned)
+					{
+						m_Fallback.destroy(p);
+						return;
+					}
 				}
-			}
 
-			p->~T();
+				p->~T();
+			}
 		}
 #pragma endregion
 
@@ -195,6 +236,42 @@ namespace ktl
 
 			return m_Fallback.owns(p);
 		}
+
+		template<typename Primary = P, typename Fallback = F>
+		typename std::enable_if<detail::has_trim_v<Primary> || detail::has_trim_v<Fallback>, void>::type
+		trim() noexcept(
+			(!detail::has_trim_v<Primary> || detail::has_nothrow_trim_v<Primary>) &&
+			(!detail::has_trim_v<Fallback> || detail::has_nothrow_trim_v<Fallback>))
+		{
+			if constexpr (detail::has_trim_v<Primary>)
+				m_Primary.trim();
+
+			if constexpr (detail::has_trim_v<Fallback>)
+				m_Fallback.trim();
+		}
+
+		/**
+		 * @brief Prepares both allocators to serve a budget of @p n bytes on their own, if they define reserve()
+		 * @note The budget isn't split by the threshold, since it says nothing about the sizes of the allocations that follow
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether every allocator with a reserve() method could reserve the memory
+		*/
+		template<typename Primary = P, typename Fallback = F>
+		typename std::enable_if<detail::has_reserve_v<Primary> || detail::has_reserve_v<Fallback>, bool>::type
+		reserve(size_t n) noexcept(
+			(!detail::has_reserve_v<Primary> || detail::has_nothrow_reserve_v<Primary>) &&
+			(!detail::has_reserve_v<Fallback> || detail::has_nothrow_reserve_v<Fallback>))
+		{
+			bool reserved = true;
+
+			if constexpr (detail::has_reserve_v<Primary>)
+				reserved = m_Primary.reserve(n) && reserved;
+
+			if constexpr (detail::has_reserve_v<Fallback>)
+				reserved = m_Fallback.reserve(n) && reserved;
+
+			return reserved;
+		}
 #pragma endregion
 
 	private:
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/current_cpu.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/source_location.h"
+#include "sharded_fwd.h"
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief An allocator which keeps an instance of the given allocator per shard, and picks one based on the CPU the caller is running on.
+	 * Each shard is guarded by its own mutex, which is rarely contended, since threads on different CPUs use different shards.
+	 * This makes the memory footprint scale with the number of cores, rather than the number of threads.
+	 * If the shard fails to allocate, the other shards are tried in turn.
+	 * @note If the allocator has an owns(*ptr) method, memory is deallocated to the shard that owns it, which may require visiting every shard.
+	 * Otherwise it is deallocated to the caller's current shard, which requires memory from any shard to be interchangeable, like with a freelist on top of a mallocator.
+	 * @tparam Alloc The allocator type to create instances from
+	 * @tparam Shards The number of instances to create. Ideally at least the number of CPUs
+	*/
+	template<typename Alloc, size_t Shards>
+	class sharded
+	{
+	private:
+		static_assert(detail::has_no_value_type_v<Alloc>, "Building on top of typed allocators is not allowed. Use allocators without a type");
+		static_assert(Shards > 0, "The sharded allocator requires at least 1 shard");
+
+	public:
+		typedef typename detail::get_size_type_t<Alloc> size_type;
+
+	private:
+		static constexpr size_t CACHE_LINE = 64;
+
+		// Aligned to a cache line to avoid false sharing between shards
+		struct alignas(CACHE_LINE) shard
+		{
+			shard() = default;
+
+			template<typename... Args>
+			shard(size_t, Args&... args) :
+				Allocator(args...),
+				Lock() {}
+
+			KTL_EMPTY_BASE Alloc Allocator;
+			std::mutex Lock;
+		};
+
+	public:
+		sharded()
+			noexcept(std::is_nothrow_default_constructible_v<Alloc>) :
+			m_Shards() {}
+
+		/**
+		 * @brief Constructor for forwarding any arguments to the underlying allocators
+		 * @note Every shard is constructed from the same arguments, so they are never moved from
+		*/
+		template<typename... Args,
+			typename = std::enable_if_t<
+			std::is_constructible_v<Alloc, Args&...>>>
+		explicit sharded(Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Alloc, Args&...>) :
+			sharded(std::make_index_sequence<Shards>(), args...) {}
+
+		sharded(const sharded&) = delete;
+		sharded(sharded&&) = delete;
+
+		sharded& operator=(const sharded&) = delete;
+		sharded& operator=(sharded&&) = delete;
+
+		bool operator==(const sharded& rhs) const noexcept
+		{
+			return this == &rhs;
+		}
+
+		bool operator!=(const sharded& rhs) const noexcept
+		{
+			return this != &rhs;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n from the shard of the current CPU
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n, const source_location source = KTL_SOURCE())
+			noexcept(detail::has_nothrow_allocate_v<Alloc>)
+		{
+			size_t index = detail::current_cpu() % Shards;
+
+			for (size_t i = 0; i < Shards; i++)
+			{
+				shard& current = m_Shards[(index + i) % Shards];
+
+				try
+				{
+					std::lock_guard<std::mutex> lock(current.Lock);
+
+					if (void* p = detail::allocate(current.Allocator, n, source))
+						return p;
+				}
+				catch (const std::system_error&) {}
+			}
+
+			return nullptr;
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @note Starts with the shard of the current CPU, since memory is usually deallocated by the same thread that allocated it
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_deallocate_v<Alloc> && (!detail::has_owns_v<Alloc> || detail::has_nothrow_try_deallocate_v<Alloc>))
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t index = detail::current_cpu() % Shards;
+
+			if constexpr (detail::has_owns_v<Alloc> || detail::has_try_deallocate_v<Alloc>)
+			{
+				for (size_t i = 0; i < Shards; i++)
+				{
+					shard& current = m_Shards[(index + i) % Shards];
+
+					try
+					{
+						std::lock_guard<std::mutex> lock(current.Lock);
+
+						if (detail::try_deallocate(current.Allocator, p, n))
+							return;
+					}
+					catch (const std::system_error&) {}
+				}
+
+				// If we ever get to this point, the memory was not allocated by any of the shards
+				KTL_ASSERT(false);
+			}
+			else
+			{
+				shard& current = m_Shards[index];
+
+				try
+				{
+					std::lock_guard<std::mutex> lock(current.Lock);
+
+					current.Allocator.deallocate(p, n);
+				}
+				catch (const std::system_error&) {}
+			}
+		}
+#pragma endregion
+
+#pragma region Utility
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_max_size_v<A>, size_type>::type
+		max_size() const
+			noexcept(detail::has_nothrow_max_size_v<A>)
+		{
+			return m_Shards[0].Allocator.max_size();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_owns_v<A>, bool>::type
+		owns(void* p) const
+			noexcept(detail::has_nothrow_owns_v<A>)
+		{
+			for (size_t i = 0; i < Shards; i++)
+			{
+				shard& current = m_Shards[i];
+
+				try
+				{
+					std::lock_guard<std::mutex> lock(current.Lock);
+
+					if (current.Allocator.owns(p))
+						return true;
+				}
+				catch (const std::system_error&) {}
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Trims every shard
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			for (size_t i = 0; i < Shards; i++)
+			{
+				try
+				{
+					std::lock_guard<std::mutex> lock(m_Shards[i].Lock);
+
+					m_Shards[i].Allocator.trim();
+				}
+				catch (const std::system_error&) {}
+			}
+		}
+
+		/**
+		 * @brief Prepares every shard to serve @p n bytes on its own
+		 * @param n The amount of bytes each shard should prepare for
+		 * @return Whether every shard could reserve the memory
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			bool reserved = true;
+
+			for (size_t i = 0; i < Shards; i++)
+			{
+				try
+				{
+					std::lock_guard<std::mutex> lock(m_Shards[i].Lock);
+
+					reserved = m_Shards[i].Allocator.reserve(n) && reserved;
+				}
+				catch (const std::system_error&)
+				{
+					reserved = false;
+				}
+			}
+
+			return reserved;
+		}
+#pragma endregion
+
+	private:
+		template<size_t... Indices, typename... Args>
+		sharded(std::index_sequence<Indices...>, Args&... args)
+			noexcept(std::is_nothrow_constructible_v<Alloc, Args&...>) :
+			m_Shards{ { Indices, args... }... } {}
+
+	private:
+		mutable shard m_Shards[Shards];
+	};
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "shared_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// Wrapper class for spreading allocations across an allocator per CPU
+	template<typename Alloc, size_t Shards = 16>
+	class sharded;
+
+	/**
+	 * @brief Shorthand for a typed, atomic-ref-counted sharded allocator
+	*/
+	template<typename T, typename Alloc, size_t Shards = 16>
+	using type_shared_sharded = type_allocator<T, atomic_shared<sharded<Alloc, Shards>>>;
+}
\ No newline at end of file
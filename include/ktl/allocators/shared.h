@@ -141,6 +141,22 @@ namespace ktl
 		{
 			m_Block->Allocator.deallocate(p, n);
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_expand_v<A>, bool>::type
+		expand(void* p, size_t n, size_t new_n)
+			noexcept(detail::has_nothrow_expand_v<A>)
+		{
+			return m_Block->Allocator.expand(p, n, new_n);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_try_deallocate_v<A>, bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<A>)
+		{
+			return m_Block->Allocator.try_deallocate(p, n);
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -177,6 +193,22 @@ namespace ktl
 		{
 			return m_Block->Allocator.owns(p);
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			m_Block->Allocator.trim();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return m_Block->Allocator.reserve(n);
+		}
 #pragma endregion
 
 		Alloc& get_allocator() noexcept
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/mapped_heap.h"
+#include "../utility/mapped_memory.h"
+#include "mmap_file_allocator.h"
+#include "shm_allocator_fwd.h"
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace ktl
+{
+	/**
+	 * @brief A named segment of shared memory, with a heap inside it that other processes on the same host can map and allocate from.
+	 * The first process to open the segment creates it, while the rest wait for it to be initialized.
+	 * Objects built in the segment using a shm_allocator can be published under a name with set_root(), so other processes can find them with get_root().
+	 * Containers stored in the segment must use offset pointers, which type_shm_allocator does by default.
+	 * @note The heap is guarded by a spinlock inside the segment, so allocating is safe from any process, but the objects inside it are not.
+	 * On POSIX systems the segment outlives the processes that use it, until remove() is called
+	*/
+	class shm_segment
+	{
+	public:
+		/**
+		 * @brief Opens or creates the shared memory segment called @p name and maps it into memory
+		 * @note Check is_open() afterwards to see whether it succeeded
+		 * @param name The name of the segment. On POSIX systems it should start with a slash
+		 * @param size The size of the segment, if it is created by this call
+		*/
+		shm_segment(const char* name, size_t size) noexcept :
+			m_Data(nullptr),
+			m_Size(size),
+			m_Heap(nullptr)
+		{
+			bool created = false;
+			m_Data = detail::map_shared(name, m_Size, created);
+
+			if (created)
+				m_Heap = detail::mapped_heap::create(m_Data, m_Size);
+
+			// Another process may still be initializing the heap
+			for (size_t i = 0; m_Data && !m_Heap && !created && i < 1000; i++)
+			{
+				m_Heap = detail::mapped_heap::open(m_Data, m_Size);
+
+				if (!m_Heap)
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			if (m_Data && !m_Heap)
+			{
+				detail::unmap_file(m_Data, m_Size);
+				m_Data = nullptr;
+			}
+		}
+
+		shm_segment(const shm_segment&) = delete;
+
+		shm_segment(shm_segment&& other) noexcept :
+			m_Data(other.m_Data),
+			m_Size(other.m_Size),
+			m_Heap(other.m_Heap)
+		{
+			other.m_Data = nullptr;
+			other.m_Size = 0;
+			other.m_Heap = nullptr;
+		}
+
+		~shm_segment() noexcept
+		{
+			if (m_Data)
+				detail::unmap_file(m_Data, m_Size);
+		}
+
+		shm_segment& operator=(const shm_segment&) = delete;
+
+		shm_segment& operator=(shm_segment&& rhs) noexcept
+		{
+			if (m_Data)
+				detail::unmap_file(m_Data, m_Size);
+
+			m_Data = rhs.m_Data;
+			m_Size = rhs.m_Size;
+			m_Heap = rhs.m_Heap;
+
+			rhs.m_Data = nullptr;
+			rhs.m_Size = 0;
+			rhs.m_Heap = nullptr;
+
+			return *this;
+		}
+
+		/**
+		 * @brief Removes the shared memory segment called @p name, once every process has unmapped it.
+		 * Processes which open it afterwards will create a new segment
+		 * @return Whether the segment could be removed
+		*/
+		static bool remove(const char* name) noexcept
+		{
+			return detail::unlink_shared(name);
+		}
+
+		/**
+		 * @brief Returns whether the segment was opened and contains a valid heap
+		*/
+		bool is_open() const noexcept
+		{
+			return m_Heap != nullptr;
+		}
+
+		/**
+		 * @brief Returns the size of the mapped segment in bytes
+		*/
+		size_t size() const noexcept
+		{
+			return m_Size;
+		}
+
+		/**
+		 * @brief Returns an allocator which allocates from the heap inside the segment
+		*/
+		shm_allocator get_allocator() const noexcept
+		{
+			return shm_allocator(m_Heap);
+		}
+
+		/**
+		 * @brief Returns an object that has been published in the segment, possibly by another process
+		 * @param name The name the object was published under. Unnamed if unspecified
+		 * @return The object or nullptr if nothing has been published under that name
+		*/
+		template<typename T>
+		T* get_root(const char* name = "") const noexcept
+		{
+			KTL_ASSERT(m_Heap);
+
+			return static_cast<T*>(m_Heap->get_root(name));
+		}
+
+		/**
+		 * @brief Publishes an object in the segment under @p name, so that other processes can find it
+		 * @param name The name of the root, which must be shorter than 32 characters
+		 * @param p The object, which must be allocated from this segment. Passing nullptr removes it
+		 * @return Whether the root could be published. Up to 16 roots can be published
+		*/
+		bool set_root(const char* name, void* p) noexcept
+		{
+			KTL_ASSERT(m_Heap);
+
+			return m_Heap->set_root(name, p);
+		}
+
+	private:
+		void* m_Data;
+		size_t m_Size;
+		detail::mapped_heap* m_Heap;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "mmap_file_allocator_fwd.h"
+#include "type_allocator_fwd.h"
+
+namespace ktl
+{
+	// A named shared memory segment, which owns the mapping
+	class shm_segment;
+
+	/**
+	 * @brief An allocator which allocates from the heap inside a shm_segment.
+	 * The heap is laid out the same way as in a mmap_file, so the same allocator is used for both
+	*/
+	typedef mmap_file_allocator shm_allocator;
+
+	/**
+	 * @brief Shorthand for a typed allocator in a shared memory segment
+	*/
+	template<typename T>
+	using type_shm_allocator = type_allocator<T, shm_allocator>;
+}
\ No newline at end of file
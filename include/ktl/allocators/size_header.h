@@ -0,0 +1,206 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/source_location.h"
+#include "size_header_fwd.h"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief An allocator which stores the size of each allocation in a small header in front of it.
+	 * This allows memory to be deallocated without knowing its size, like with free(), while the underlying allocator
+	 * still receives the original size, so composites like segragator and freelist can route on it.
+	 * @note The header takes up detail::ALIGNMENT bytes, so the alignment of the underlying allocator is preserved.
+	 * Size thresholds in the underlying allocator will see the size including the header.
+	 * @tparam Alloc The allocator to wrap around
+	*/
+	template<typename Alloc>
+	class size_header
+	{
+	private:
+		static_assert(detail::has_no_value_type_v<Alloc>, "Building on top of typed allocators is not allowed. Use allocators without a type");
+
+	public:
+		typedef typename detail::get_size_type_t<Alloc> size_type;
+
+	private:
+		static_assert(sizeof(size_type) <= detail::ALIGNMENT, "The size type must fit within the header");
+
+		static constexpr size_t HEADER_SIZE = detail::ALIGNMENT;
+
+	public:
+		template<typename A = Alloc>
+		size_header()
+			noexcept(std::is_nothrow_default_constructible_v<A>) :
+			m_Alloc() {}
+
+		/**
+		 * @brief Constructor for forwarding any arguments to the underlying allocator
+		*/
+		template<typename... Args,
+			typename = std::enable_if_t<
+			std::is_constructible_v<Alloc, Args...>>>
+		explicit size_header(Args&&... args)
+			noexcept(std::is_nothrow_constructible_v<Alloc, Args...>) :
+			m_Alloc(std::forward<Args>(args)...) {}
+
+		size_header(const size_header&) = default;
+
+		size_header(size_header&&) = default;
+
+		size_header& operator=(const size_header&) = default;
+
+		size_header& operator=(size_header&&) = default;
+
+		bool operator==(const size_header& rhs) const
+			noexcept(detail::has_nothrow_equal_v<Alloc>)
+		{
+			return m_Alloc == rhs.m_Alloc;
+		}
+
+		bool operator!=(const size_header& rhs) const
+			noexcept(detail::has_nothrow_not_equal_v<Alloc>)
+		{
+			return m_Alloc != rhs.m_Alloc;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n, with a header in front of it
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n, const source_location source = KTL_SOURCE())
+			noexcept(detail::has_nothrow_allocate_v<Alloc>)
+		{
+			size_t total = n + HEADER_SIZE;
+			if (total < n)
+				return nullptr;
+
+			char* block = static_cast<char*>(detail::allocate(m_Alloc, total, source));
+
+			if (!block)
+				return nullptr;
+
+			*reinterpret_cast<size_type*>(block) = size_type(total);
+
+			return block + HEADER_SIZE;
+		}
+
+		/**
+		 * @brief Deallocates the memory at location @p p
+		 * @note The size is read from the header, so @p n is only used for validation
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			KTL_ASSERT(p != nullptr);
+			KTL_ASSERT(size(p) == n);
+
+			deallocate(p);
+		}
+
+		/**
+		 * @brief Deallocates the memory at location @p p, without knowing its size
+		 * @param p The location in memory to deallocate
+		*/
+		void deallocate(void* p)
+			noexcept(detail::has_nothrow_deallocate_v<Alloc>)
+		{
+			KTL_ASSERT(p != nullptr);
+
+			char* block = static_cast<char*>(p) - HEADER_SIZE;
+
+			m_Alloc.deallocate(block, *reinterpret_cast<size_type*>(block));
+		}
+#pragma endregion
+
+#pragma region Construction
+		template<typename T, typename... Args>
+		typename std::enable_if<detail::has_construct_v<Alloc, T*, Args...>, void>::type
+		construct(T* p, Args&&... args)
+			noexcept(detail::has_nothrow_construct_v<Alloc, T*, Args...>)
+		{
+			m_Alloc.construct(p, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		typename std::enable_if<detail::has_destroy_v<Alloc, T*>, void>::type
+		destroy(T* p)
+			noexcept(detail::has_nothrow_destroy_v<Alloc, T*>)
+		{
+			m_Alloc.destroy(p);
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the size that was requested when the memory at location @p p was allocated
+		 * @param p The location in memory, as returned by allocate()
+		 * @return The size of the allocation in bytes
+		*/
+		size_type size(void* p) const noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			return *reinterpret_cast<size_type*>(static_cast<char*>(p) - HEADER_SIZE) - HEADER_SIZE;
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_max_size_v<A>, size_type>::type
+		max_size() const
+			noexcept(detail::has_nothrow_max_size_v<A>)
+		{
+			size_type max = m_Alloc.max_size();
+
+			return max > HEADER_SIZE ? max - HEADER_SIZE : 0;
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_owns_v<A>, bool>::type
+		owns(void* p) const
+			noexcept(detail::has_nothrow_owns_v<A>)
+		{
+			return m_Alloc.owns(static_cast<char*>(p) - HEADER_SIZE);
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			m_Alloc.trim();
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return m_Alloc.reserve(n);
+		}
+#pragma endregion
+
+		Alloc& get_allocator() noexcept
+		{
+			return m_Alloc;
+		}
+
+		const Alloc& get_allocator() const noexcept
+		{
+			return m_Alloc;
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "shared_fwd.h"
+#include "type_allocator_fwd.h"
+
+namespace ktl
+{
+	// Wrapper class for storing the size of an allocation in a header
+	template<typename Alloc>
+	class size_header;
+
+	/**
+	 * @brief Shorthand for a typed allocator which stores the size of each allocation in a header
+	*/
+	template<typename T, typename Alloc>
+	using type_size_header_allocator = type_allocator<T, size_header<Alloc>>;
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../utility/alignment.h"
+#include "../utility/assert.h"
 #include "stack_allocator_fwd.h"
 #include "type_allocator.h"
 
@@ -88,6 +89,35 @@ namespace ktl
 			if (m_Block->ObjectCount == 0)
 				m_Block->Free = m_Block->Data;
 		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made can be resized
+		 * @param p The location in memory to resize. Must be owned by this allocator
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+			KTL_ASSERT(owns(p));
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			size_t newSize = new_n + detail::align_to_architecture(new_n);
+
+			// Only the last allocation can be resized in place
+			if (m_Block->Free - totalSize != p)
+				return false;
+
+			if ((size_t(m_Block->Free - m_Block->Data) - totalSize + newSize) > Size)
+				return false;
+
+			m_Block->Free = static_cast<char*>(p) + newSize;
+			m_Block->ObjectCount = m_Block->ObjectCount - totalSize + newSize;
+
+			return true;
+		}
 #pragma endregion
 
 #pragma region Utility
@@ -66,7 +66,7 @@ namespace ktl
 			{
 				std::lock_guard<std::mutex> lock(m_Lock);
 
-				return m_Alloc.allocate(n, source);
+				return detail::allocate(m_Alloc, n, source);
 			}
 			catch (const std::system_error&)
 			{
@@ -85,6 +85,40 @@ namespace ktl
 			}
 			catch (const std::system_error&) {}
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_expand_v<A>, bool>::type
+		expand(void* p, size_t n, size_t new_n)
+			noexcept(detail::has_nothrow_expand_v<A>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return m_Alloc.expand(p, n, new_n);
+			}
+			catch (const std::system_error&)
+			{
+				return false;
+			}
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_try_deallocate_v<A>, bool>::type
+		try_deallocate(void* p, size_t n)
+			noexcept(detail::has_nothrow_try_deallocate_v<A>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return m_Alloc.try_deallocate(p, n);
+			}
+			catch (const std::system_error&)
+			{
+				return false;
+			}
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -125,6 +159,37 @@ namespace ktl
 		{
 			return m_Alloc.owns(p);
 		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				m_Alloc.trim();
+			}
+			catch (const std::system_error&) {}
+		}
+
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			try
+			{
+				std::lock_guard<std::mutex> lock(m_Lock);
+
+				return m_Alloc.reserve(n);
+			}
+			catch (const std::system_error&)
+			{
+				return false;
+			}
+		}
 #pragma endregion
 
 		Alloc& get_allocator() noexcept
@@ -32,6 +32,7 @@ namespace ktl
 
 	public:
 		typedef T value_type;
+		typedef typename detail::get_pointer_type_t<Alloc, T> pointer;
 		typedef typename detail::get_size_type_t<Alloc> size_type;
 		typedef std::false_type is_always_equal;
 
@@ -96,7 +97,7 @@ namespace ktl
 		 * @param n The amount of objects to allocate memory for. Not in bytes, but number of T
 		 * @return A location in memory that is at least @p n objects big or nullptr if it could not be allocated
 		*/
-		value_type* allocate(size_t n, const source_location source = KTL_SOURCE())
+		pointer allocate(size_t n, const source_location source = KTL_SOURCE())
 			noexcept(noexcept(m_Alloc.allocate(n)))
 		{
 			return reinterpret_cast<value_type*>(detail::allocate(m_Alloc, sizeof(value_type) * n, source));
@@ -107,11 +108,27 @@ namespace ktl
 		 * @param p The location in memory to deallocate
 		 * @param n The size that was initially allocated
 		*/
-		void deallocate(value_type* p, size_t n)
+		void deallocate(pointer p, size_t n)
 			noexcept(noexcept(m_Alloc.deallocate(p, n)))
 		{
 			m_Alloc.deallocate(p, sizeof(value_type) * n);
 		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only defined if the underlying allocator defines it
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to. Not in bytes, but number of T
+		 * @return Whether the memory could be resized without moving it
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_expand_v<A>, bool>::type
+		expand(value_type* p, size_t n, size_t new_n)
+			noexcept(detail::has_nothrow_expand_v<A>)
+		{
+			return m_Alloc.expand(p, sizeof(value_type) * n, sizeof(value_type) * new_n);
+		}
 #pragma endregion
 
 #pragma region Construction
@@ -171,6 +188,32 @@ namespace ktl
 		{
 			return m_Alloc.owns(p);
 		}
+
+		/**
+		 * @brief Returns any memory cached by the underlying allocator to its parent, or the OS
+		 * @note Only defined if the underlying allocator defines it
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_trim_v<A>, void>::type
+		trim()
+			noexcept(detail::has_nothrow_trim_v<A>)
+		{
+			m_Alloc.trim();
+		}
+
+		/**
+		 * @brief Prepares the underlying allocator to serve @p n objects without going to its parent, or the OS
+		 * @note Only defined if the underlying allocator defines it
+		 * @param n The amount of objects to prepare for. Not in bytes, but number of T
+		 * @return Whether the memory could be reserved
+		*/
+		template<typename A = Alloc>
+		typename std::enable_if<detail::has_reserve_v<A>, bool>::type
+		reserve(size_t n)
+			noexcept(detail::has_nothrow_reserve_v<A>)
+		{
+			return m_Alloc.reserve(sizeof(value_type) * n);
+		}
 #pragma endregion
 
 		/**
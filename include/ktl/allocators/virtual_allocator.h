@@ -0,0 +1,297 @@
+#pragma once
+
+#include "../utility/alignment.h"
+#include "../utility/assert.h"
+#include "../utility/virtual_memory.h"
+#include "virtual_allocator_fwd.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A linear allocator which reserves a contiguous range of virtual memory up front, and commits pages as it grows.
+	 * Addresses never move, so the last allocation can always be expanded in place and ownership is a single range check.
+	 * Only the pages that have actually been handed out take up physical memory.
+	 * @tparam Size The amount of address space to reserve, which can be much larger than the physical memory available
+	*/
+	template<size_t Size>
+	class virtual_allocator
+	{
+	private:
+		static_assert(Size > 0, "The reserved size must be greater than 0");
+
+		// Commit in larger chunks to avoid a syscall on every new page
+		static constexpr size_t COMMIT_SIZE = 65536;
+
+	public:
+		virtual_allocator() noexcept :
+			m_Begin(static_cast<char*>(detail::virtual_reserve(Size))),
+			m_Free(m_Begin),
+			m_Committed(m_Begin),
+			m_ObjectCount(0) {}
+
+		virtual_allocator(const virtual_allocator&) = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @note The reserved range is transferred, so any allocations remain valid
+		 * @param other The original allocator
+		*/
+		virtual_allocator(virtual_allocator&& other) noexcept :
+			m_Begin(other.m_Begin),
+			m_Free(other.m_Free),
+			m_Committed(other.m_Committed),
+			m_ObjectCount(other.m_ObjectCount)
+		{
+			other.m_Begin = nullptr;
+			other.m_Free = nullptr;
+			other.m_Committed = nullptr;
+			other.m_ObjectCount = 0;
+		}
+
+		~virtual_allocator() noexcept
+		{
+			if (m_Begin)
+				detail::virtual_release(m_Begin, Size);
+		}
+
+		virtual_allocator& operator=(const virtual_allocator&) = delete;
+
+		/**
+		 * @brief Move assignment operator
+		 * @note The reserved range is transferred, so any allocations remain valid
+		 * @param rhs The original allocator
+		*/
+		virtual_allocator& operator=(virtual_allocator&& rhs) noexcept
+		{
+			if (m_Begin)
+				detail::virtual_release(m_Begin, Size);
+
+			m_Begin = rhs.m_Begin;
+			m_Free = rhs.m_Free;
+			m_Committed = rhs.m_Committed;
+			m_ObjectCount = rhs.m_ObjectCount;
+
+			rhs.m_Begin = nullptr;
+			rhs.m_Free = nullptr;
+			rhs.m_Committed = nullptr;
+			rhs.m_ObjectCount = 0;
+
+			return *this;
+		}
+
+		bool operator==(const virtual_allocator& rhs) const noexcept
+		{
+			return this == &rhs;
+		}
+
+		bool operator!=(const virtual_allocator& rhs) const noexcept
+		{
+			return this != &rhs;
+		}
+
+#pragma region Allocation
+		/**
+		 * @brief Attempts to allocate a chunk of memory defined by @p n
+		 * @param n The amount of bytes to allocate memory for
+		 * @return A location in memory that is at least @p n bytes big or nullptr if it could not be allocated
+		*/
+		void* allocate(size_t n) noexcept
+		{
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			if (!m_Begin || (size_t(m_Free - m_Begin) + totalSize) > Size)
+				return nullptr;
+
+			if (!commit(m_Free + totalSize))
+				return nullptr;
+
+			char* current = m_Free;
+
+			m_Free += totalSize;
+			m_ObjectCount += totalSize;
+
+			return current;
+		}
+
+		/**
+		 * @brief Attempts to deallocate the memory at location @p p
+		 * @note The memory is only completely deallocated if it was the last allocation made or all memory has been deallocated.
+		 * The pages stay committed for later allocations, until reset() is called
+		 * @param p The location in memory to deallocate
+		 * @param n The size that was initially allocated
+		*/
+		void deallocate(void* p, size_t n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+
+			if (m_Free - totalSize == p)
+				m_Free -= totalSize;
+
+			m_ObjectCount -= totalSize;
+
+			// Assumes that people don't deallocate the same memory twice
+			if (m_ObjectCount == 0)
+				m_Free = m_Begin;
+		}
+
+		/**
+		 * @brief Attempts to resize the memory at location @p p in place
+		 * @note Only the last allocation made can be resized, but it can grow until the whole range is used
+		 * @param p The location in memory to resize
+		 * @param n The size that was initially allocated
+		 * @param new_n The size to resize to
+		 * @return Whether the memory could be resized without moving it
+		*/
+		bool expand(void* p, size_t n, size_t new_n) noexcept
+		{
+			KTL_ASSERT(p != nullptr);
+
+			size_t totalSize = n + detail::align_to_architecture(n);
+			size_t newSize = new_n + detail::align_to_architecture(new_n);
+
+			if (m_Free - totalSize != p)
+				return false;
+
+			if ((size_t(m_Free - m_Begin) - totalSize + newSize) > Size)
+				return false;
+
+			if (!commit(static_cast<char*>(p) + newSize))
+				return false;
+
+			m_Free = static_cast<char*>(p) + newSize;
+			m_ObjectCount = m_ObjectCount - totalSize + newSize;
+
+			return true;
+		}
+#pragma endregion
+
+#pragma region Utility
+		/**
+		 * @brief Returns the maximum size that an allocation can be
+		 * @return The maximum size an allocation may be
+		*/
+		size_t max_size() const noexcept
+		{
+			return Size;
+		}
+
+		/**
+		 * @brief Returns whether or not the allocator owns the given location in memory
+		 * @param p The location of the object in memory
+		 * @return Whether the allocator owns @p p
+		*/
+		bool owns(void* p) const noexcept
+		{
+			// Nothing has been reserved yet, so nothing can be owned
+			if (!m_Begin)
+				return false;
+
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+			uintptr_t low = reinterpret_cast<uintptr_t>(m_Begin);
+			uintptr_t high = low + Size;
+
+			return ptr >= low && ptr < high;
+		}
+
+		/**
+		 * @brief Returns the amount of memory that is currently committed
+		 * @return The amount of bytes backed by physical memory
+		*/
+		size_t committed() const noexcept
+		{
+			return size_t(m_Committed - m_Begin);
+		}
+
+		/**
+		 * @brief Deallocates everything at once and returns the committed pages to the OS.
+		 * The address range itself stays reserved
+		*/
+		void reset() noexcept
+		{
+			if (m_Committed != m_Begin)
+				detail::virtual_decommit(m_Begin, size_t(m_Committed - m_Begin));
+
+			m_Free = m_Begin;
+			m_Committed = m_Begin;
+			m_ObjectCount = 0;
+		}
+
+		/**
+		 * @brief Decommits the pages after the last allocation, returning them to the OS
+		 * @note The address space stays reserved, so the pages are committed again when needed
+		*/
+		void trim() noexcept
+		{
+			size_t page = detail::virtual_page_size();
+			char* end = m_Begin + ((size_t(m_Free - m_Begin) + page - 1) & ~(page - 1));
+
+			if (end < m_Committed)
+			{
+				detail::virtual_decommit(end, size_t(m_Committed - end));
+
+				m_Committed = end;
+			}
+		}
+
+		/**
+		 * @brief Commits enough pages to serve @p n more bytes and touches them, so later allocations don't page fault
+		 * @param n The amount of bytes to prepare for
+		 * @return Whether the pages could be committed
+		*/
+		bool reserve(size_t n) noexcept
+		{
+			if (!m_Begin || (size_t(m_Free - m_Begin) + n) > Size)
+				return false;
+
+			char* end = m_Free + n;
+
+			if (!commit(end))
+				return false;
+
+			// Only write to memory which hasn't been handed out yet
+			size_t page = detail::virtual_page_size();
+			for (char* p = m_Free; p < end; p = m_Begin + ((size_t(p - m_Begin) + page) & ~(page - 1)))
+				*static_cast<volatile char*>(p) = 0;
+
+			return true;
+		}
+#pragma endregion
+
+	private:
+		bool commit(char* end) noexcept
+		{
+			if (end <= m_Committed)
+				return true;
+
+			size_t page = detail::virtual_page_size();
+			size_t limit = (Size + page - 1) & ~(page - 1);
+			size_t current = size_t(m_Committed - m_Begin);
+
+			size_t growth = (std::max)(size_t(end - m_Committed), COMMIT_SIZE);
+			growth = (growth + page - 1) & ~(page - 1);
+
+			if (current + growth > limit)
+				growth = limit - current;
+
+			if (!detail::virtual_commit(m_Committed, growth))
+				return false;
+
+			m_Committed += growth;
+
+			return true;
+		}
+
+	private:
+		char* m_Begin;
+		char* m_Free;
+		char* m_Committed;
+		size_t m_ObjectCount;
+	};
+}
\ No newline at end of file
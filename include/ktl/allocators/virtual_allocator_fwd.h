@@ -0,0 +1,33 @@
+#pragma once
+
+#include "reference_fwd.h"
+#include "shared_fwd.h"
+#include "threaded_fwd.h"
+#include "type_allocator_fwd.h"
+
+#include <cstddef>
+
+namespace ktl
+{
+	// virtual_allocator
+	template<size_t Size>
+	class virtual_allocator;
+
+	/**
+	 * @brief Shorthand for a typed virtual allocator
+	*/
+	template<typename T, size_t Size>
+	using type_virtual_allocator = type_allocator<T, virtual_allocator<Size>>;
+
+	/**
+	 * @brief Shorthand for a typed, weak-reference virtual allocator
+	*/
+	template<typename T, size_t Size>
+	using type_reference_virtual_allocator = type_allocator<T, reference<virtual_allocator<Size>>>;
+
+	/**
+	 * @brief Shorthand for a typed, ref-counted virtual allocator
+	*/
+	template<typename T, size_t Size>
+	using type_shared_virtual_allocator = type_allocator<T, shared<virtual_allocator<Size>>>;
+}
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "../utility/empty_base.h"
 #include "binary_heap_fwd.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -12,21 +14,24 @@
 namespace ktl
 {
     /**
-     * @brief A priority queue implemented as a binary heap
+     * @brief A priority queue implemented as a binary heap, or a d-ary heap if @p Arity is larger than 2
      * @tparam T The type to use. Must be move constructible and move assignable
      * @tparam Comp The comparison function. Usually std::greater<T> or std::less<T>
      * @tparam Alloc The type of allocoator to use
+     * @tparam Arity The number of children of each node. A higher arity makes the heap shallower
     */
-    template<typename T, typename Comp, typename Alloc>
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
     class binary_heap
     {
     private:
         static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
         static_assert(std::is_move_assignable_v<T>, "T must be move assignable");
+        static_assert(Arity >= 2, "The heap must have an arity of at least 2");
 
         static_assert(std::is_default_constructible_v<Alloc> || std::is_copy_constructible_v<Alloc>, "The allocator must be default or copy constructible");
 
         typedef std::allocator_traits<Alloc> Traits;
+        typedef typename Traits::pointer pointer;
 
     public:
         typedef T* iterator;
@@ -85,36 +90,53 @@ namespace ktl
             m_Begin(Traits::allocate(m_Alloc, capacity)) {}
 
         /**
-         * @brief Construct the binary heap with the given comparator and an initial set of values
+         * @brief Construct the binary heap with the given comparator and an initial set of values. Takes O(n) time.
          * @param initializer A list of values to insert into the binary heap
          * @param comp The comparator to use. Will be default constructed if unspecified
         */
         binary_heap(std::initializer_list<T> initializer, const Comp& comp = Comp()) :
+            binary_heap(initializer.begin(), initializer.end(), comp) {}
+
+        /**
+         * @brief Construct the binary heap with the given allocator, comparator and an initial set of values. Takes O(n) time.
+         * @param initializer A list of values to insert into the binary heap
+         * @param allocator The allocator to use. Will be default constructed if unspecified
+         * @param comp The comparator to use. Will be default constructed if unspecified
+        */
+        binary_heap(std::initializer_list<T> initializer, const Alloc& allocator, const Comp& comp = Comp()) :
+            binary_heap(initializer.begin(), initializer.end(), allocator, comp) {}
+
+        /**
+         * @brief Construct the binary heap with the given comparator and a range of values. Takes O(n) time.
+         * @param first A pointer to the first element to insert
+         * @param last A pointer to one past the last element to insert
+         * @param comp The comparator to use. Will be default constructed if unspecified
+        */
+        binary_heap(const T* first, const T* last, const Comp& comp = Comp()) :
             m_Alloc(),
             m_Comp(comp),
             m_Size(0),
-            m_Capacity(initializer.size()),
-            m_Begin(Traits::allocate(m_Alloc, initializer.size()))
+            m_Capacity(size_t(last - first)),
+            m_Begin(Traits::allocate(m_Alloc, size_t(last - first)))
         {
-            for (auto value : initializer)
-                insert(value);
+            construct_heap(first, last);
         }
 
         /**
-         * @brief Construct the binary heap with the given allocator, comparator and an initial set of values
-         * @param initializer A list of values to insert into the binary heap
-         * @param allocator The allocator to use. Will be default constructed if unspecified
+         * @brief Construct the binary heap with the given allocator, comparator and a range of values. Takes O(n) time.
+         * @param first A pointer to the first element to insert
+         * @param last A pointer to one past the last element to insert
+         * @param allocator The allocator to use
          * @param comp The comparator to use. Will be default constructed if unspecified
         */
-        binary_heap(std::initializer_list<T> initializer, const Alloc& allocator, const Comp& comp = Comp()) :
+        binary_heap(const T* first, const T* last, const Alloc& allocator, const Comp& comp = Comp()) :
             m_Alloc(allocator),
             m_Comp(comp),
             m_Size(0),
-            m_Capacity(initializer.size()),
-            m_Begin(Traits::allocate(m_Alloc, initializer.size()))
+            m_Capacity(size_t(last - first)),
+            m_Begin(Traits::allocate(m_Alloc, size_t(last - first)))
         {
-            for (auto value : initializer)
-                insert(value);
+            construct_heap(first, last);
         }
 
         binary_heap(const binary_heap& other) noexcept(std::is_nothrow_copy_constructible_v<T>) :
@@ -158,12 +180,15 @@ namespace ktl
             m_Capacity(other.m_Size),
             m_Begin(Traits::allocate(m_Alloc, other.m_Size))
         {
-            // Moving using a different allocator means we can't just move, we have to reallocate
+            // Moving using a different allocator means we can't just move the pointer, we have to reallocate
             for (size_t i = 0; i < m_Size; i++)
-                Traits::construct(m_Alloc, m_Begin + i, other.m_Begin[i]);
+            {
+                Traits::construct(m_Alloc, m_Begin + i, std::move(other.m_Begin[i]));
+                Traits::destroy(other.m_Alloc, other.m_Begin + i);
+            }
 
             if (other.m_Begin != nullptr)
-                Traits::deallocate(other.m_Alloc, other.m_Begin, other.m_Capacity * sizeof(T));
+                Traits::deallocate(other.m_Alloc, other.m_Begin, other.m_Capacity);
 
             other.m_Capacity = 0;
             other.m_Size = 0;
@@ -238,13 +263,13 @@ namespace ktl
 
         const_iterator end() const noexcept { return m_Begin + m_Size; }
 
-        reverse_iterator rbegin() noexcept { return std::reverse_iterator(m_Begin + m_Size); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
 
-        const_reverse_iterator rbegin() const noexcept { return std::reverse_iterator(m_Begin + m_Size); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
 
-        reverse_iterator rend() noexcept { return std::reverse_iterator(m_Begin); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
 
-        const_reverse_iterator rend() const noexcept { return std::reverse_iterator(m_Begin); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
 
         
         /**
@@ -307,6 +332,35 @@ namespace ktl
             return m_Begin + index;
         }
 
+        /**
+         * @brief Inserts a range of elements into the heap by copying.
+         * If at least as many elements are inserted as are already in the heap, the whole heap is rebuilt in O(n) time.
+         * Otherwise each element is inserted one by one.
+         * @param first A pointer to the first element to insert. Must not point into this heap
+         * @param last A pointer to one past the last element to insert
+        */
+        void insert(const T* first, const T* last) noexcept
+        {
+            size_t n = size_t(last - first);
+            size_t oldSize = m_Size;
+
+            if (m_Size + n > m_Capacity)
+                expand(n);
+
+            for (; first != last; ++first)
+                Traits::construct(m_Alloc, m_Begin + m_Size++, *first);
+
+            if (n >= oldSize)
+            {
+                heapify();
+            }
+            else
+            {
+                for (size_t i = oldSize; i < m_Size; i++)
+                    percolateUp(i);
+            }
+        }
+
         /**
          * @brief Peeks at the root element (lowest or highest, depending on min or max heap) and returns a reference to it.
          * @return A reference to the root element.
@@ -326,11 +380,15 @@ namespace ktl
         {
             KTL_ASSERT(m_Size > 0);
 
-            T root = m_Begin[0];
+            T root = std::move(m_Begin[0]);
+
+            if (--m_Size > 0)
+                m_Begin[0] = std::move(m_Begin[m_Size]);
 
-            m_Begin[0] = std::move(m_Begin[--m_Size]);
             Traits::destroy(m_Alloc, m_Begin + m_Size);
-            percolateDown(0);
+
+            if (m_Size > 0)
+                percolateDown(0);
 
             return root;
         }
@@ -342,9 +400,11 @@ namespace ktl
         */
         iterator find(const T& value) const noexcept
         {
+            std::equal_to<T> equal;
+
             for (size_t i = 0; i < m_Size; i++)
             {
-                if (m_Begin[i] == value) // TODO: Use std::equal_to
+                if (equal(m_Begin[i], value))
                     return m_Begin + i;
             }
 
@@ -396,24 +456,37 @@ namespace ktl
             m_Begin = newData;
         }
 
-        constexpr size_t parent(size_t index) const noexcept
+        void construct_heap(const T* first, const T* last)
+        {
+            for (; first != last; ++first)
+                Traits::construct(m_Alloc, m_Begin + m_Size++, *first);
+
+            heapify();
+        }
+
+        void heapify() noexcept
         {
-            return (index - 1) / 2;
+            if (m_Size < 2)
+                return;
+
+            // Floyd's method: sift down every node which has children, starting from the bottom
+            for (size_t i = parent(m_Size - 1) + 1; i-- > 0;)
+                percolateDown(i);
         }
 
-        constexpr size_t left(size_t index) const noexcept
+        constexpr size_t parent(size_t index) const noexcept
         {
-            return index * 2 + 1;
+            return (index - 1) / Arity;
         }
 
-        constexpr size_t right(size_t index) const noexcept
+        constexpr size_t child(size_t index) const noexcept
         {
-            return index * 2 + 2;
+            return index * Arity + 1;
         }
 
-        size_t percolateUp(size_t index)
+        size_t percolateUp(size_t index) noexcept
         {
-            const T value = m_Begin[index];
+            T value = std::move(m_Begin[index]);
 
             while (index != 0 && m_Comp(value, m_Begin[parent(index)]))
             {
@@ -426,36 +499,33 @@ namespace ktl
             return index;
         }
 
-        void percolateDown(size_t index) noexcept
+        size_t percolateDown(size_t index) noexcept
         {
-            size_t parent = index;
+            T value = std::move(m_Begin[index]);
 
-            const T value = m_Begin[index];
-
-            while (parent < m_Size)
+            while (child(index) < m_Size)
             {
-                size_t l = left(parent);
-                size_t r = right(parent);
-
-                size_t child = parent;
-
-                if (l < m_Size && m_Comp(m_Begin[l], m_Begin[child]))
-                    child = l;
-
-                if (r < m_Size && m_Comp(m_Begin[r], m_Begin[child]))
-                    child = r;
-
-                if (child == parent)
+                // Find the best of the (up to) Arity children, which are stored next to each other
+                size_t first = child(index);
+                size_t last = (std::min)(first + Arity, m_Size);
+
+                size_t best = first;
+                for (size_t i = first + 1; i < last; i++)
+                {
+                    if (m_Comp(m_Begin[i], m_Begin[best]))
+                        best = i;
+                }
+
+                if (!m_Comp(m_Begin[best], value))
                     break;
 
-                const T temp(std::move(m_Begin[child]));
-                m_Begin[child] = std::move(m_Begin[parent]);
-                m_Begin[parent] = std::move(temp);
-
-                parent = child;
+                m_Begin[index] = std::move(m_Begin[best]);
+                index = best;
             }
 
-            m_Begin[parent] = std::move(value);
+            m_Begin[index] = std::move(value);
+
+            return index;
         }
 
     private:
@@ -464,6 +534,6 @@ namespace ktl
 
         size_t m_Size;
         size_t m_Capacity;
-        T* m_Begin;
+        pointer m_Begin;
     };
 }
\ No newline at end of file
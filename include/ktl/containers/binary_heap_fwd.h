@@ -1,11 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <functional>
 
 namespace ktl
 {
-	template<typename T, typename Comp, typename Alloc = std::allocator<T>>
+	template<typename T, typename Comp, typename Alloc = std::allocator<T>, size_t Arity = 2>
 	class binary_heap;
 
 	/**
@@ -23,4 +24,22 @@ namespace ktl
 	*/
 	template<typename T, typename Alloc = std::allocator<T>>
 	using binary_max_heap = binary_heap<T, std::greater<T>, Alloc>;
+
+	/**
+	 * @brief An implementation of a d-ary min heap, using std::less<T>
+	 * @tparam T The type to use. Must be move constructible and move assignable
+	 * @tparam Arity The number of children of each node
+	 * @tparam Alloc The type of allocoator to use
+	*/
+	template<typename T, size_t Arity, typename Alloc = std::allocator<T>>
+	using d_ary_min_heap = binary_heap<T, std::less<T>, Alloc, Arity>;
+
+	/**
+	 * @brief An implementation of a d-ary max heap, using std::greater<T>
+	 * @tparam T The type to use. Must be move constructible and move assignable
+	 * @tparam Arity The number of children of each node
+	 * @tparam Alloc The type of allocoator to use
+	*/
+	template<typename T, size_t Arity, typename Alloc = std::allocator<T>>
+	using d_ary_max_heap = binary_heap<T, std::greater<T>, Alloc, Arity>;
 }
\ No newline at end of file
@@ -0,0 +1,628 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "indexed_heap_fwd.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+    /**
+     * @brief A priority queue implemented as a d-ary heap, which hands out handles to its elements.
+     * A handle stays valid while the element moves around in the heap, so its priority can be changed or it can be erased in O(log n) time.
+     * Like in a slot_map, a handle consists of an index into a table of slots and a generation, so a handle to a removed element is detected.
+     * @note Useful for algorithms like Dijkstra or A*, which would otherwise have to insert duplicate elements and skip them when popped
+     * @tparam T The type to use. Must be move constructible and move assignable
+     * @tparam Comp The comparison function. Usually std::greater<T> or std::less<T>
+     * @tparam Alloc The type of allocoator to use
+     * @tparam Arity The number of children of each node. Defaults to 2
+    */
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
+    class indexed_heap
+    {
+    private:
+        static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
+        static_assert(std::is_move_assignable_v<T>, "T must be move assignable");
+        static_assert(Arity >= 2, "The heap must have an arity of at least 2");
+
+        static constexpr uint32_t INVALID = UINT32_MAX;
+
+        struct slot
+        {
+            // The position of the element in the heap if the slot is in use, otherwise the next free slot
+            uint32_t Index;
+            uint32_t Generation;
+        };
+
+        typedef std::allocator_traits<Alloc> Traits;
+        typedef typename Traits::template rebind_alloc<slot> SlotAlloc;
+        typedef std::allocator_traits<SlotAlloc> SlotTraits;
+        typedef typename Traits::template rebind_alloc<uint32_t> IndexAlloc;
+        typedef std::allocator_traits<IndexAlloc> IndexTraits;
+
+        typedef typename Traits::pointer pointer;
+        typedef typename SlotTraits::pointer slot_pointer;
+        typedef typename IndexTraits::pointer index_pointer;
+
+    public:
+        typedef const T* iterator;
+        typedef const T* const_iterator;
+
+        /**
+         * @brief A handle to an element in the heap, which stays valid until the element is popped or erased
+        */
+        struct handle
+        {
+            uint32_t Index = INVALID;
+            uint32_t Generation = 0;
+
+            bool operator==(const handle& rhs) const noexcept
+            {
+                return Index == rhs.Index && Generation == rhs.Generation;
+            }
+
+            bool operator!=(const handle& rhs) const noexcept
+            {
+                return Index != rhs.Index || Generation != rhs.Generation;
+            }
+        };
+
+    public:
+        /**
+         * @brief Construct the heap with the given comparator
+         * @param comp The comparator to use. Will be default constructed if unspecified
+        */
+        indexed_heap(const Comp& comp = Comp()) noexcept :
+            m_Alloc(),
+            m_Comp(comp),
+            m_Data(nullptr),
+            m_Owners(nullptr),
+            m_Slots(nullptr),
+            m_Size(0),
+            m_Capacity(0),
+            m_SlotCount(0),
+            m_FreeHead(INVALID) {}
+
+        /**
+         * @brief Construct the heap with the given allocator and comparator
+         * @param allocator The allocator to use
+         * @param comp The comparator to use. Will be default constructed if unspecified
+        */
+        indexed_heap(const Alloc& allocator, const Comp& comp = Comp()) noexcept :
+            m_Alloc(allocator),
+            m_Comp(comp),
+            m_Data(nullptr),
+            m_Owners(nullptr),
+            m_Slots(nullptr),
+            m_Size(0),
+            m_Capacity(0),
+            m_SlotCount(0),
+            m_FreeHead(INVALID) {}
+
+        indexed_heap(const indexed_heap& other) :
+            m_Alloc(Traits::select_on_container_copy_construction(other.m_Alloc)),
+            m_Comp(other.m_Comp),
+            m_Data(nullptr),
+            m_Owners(nullptr),
+            m_Slots(nullptr),
+            m_Size(0),
+            m_Capacity(0),
+            m_SlotCount(0),
+            m_FreeHead(INVALID)
+        {
+            copy_from(other);
+        }
+
+        indexed_heap(indexed_heap&& other) noexcept :
+            m_Alloc(std::move(other.m_Alloc)),
+            m_Comp(std::move(other.m_Comp)),
+            m_Data(other.m_Data),
+            m_Owners(other.m_Owners),
+            m_Slots(other.m_Slots),
+            m_Size(other.m_Size),
+            m_Capacity(other.m_Capacity),
+            m_SlotCount(other.m_SlotCount),
+            m_FreeHead(other.m_FreeHead)
+        {
+            other.reset();
+        }
+
+        ~indexed_heap() noexcept
+        {
+            release();
+        }
+
+        indexed_heap& operator=(const indexed_heap& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+
+            release();
+
+            m_Alloc = rhs.m_Alloc;
+            m_Comp = rhs.m_Comp;
+
+            copy_from(rhs);
+
+            return *this;
+        }
+
+        indexed_heap& operator=(indexed_heap&& rhs) noexcept
+        {
+            if (this == &rhs)
+                return *this;
+
+            release();
+
+            m_Alloc = std::move(rhs.m_Alloc);
+            m_Comp = std::move(rhs.m_Comp);
+            m_Data = rhs.m_Data;
+            m_Owners = rhs.m_Owners;
+            m_Slots = rhs.m_Slots;
+            m_Size = rhs.m_Size;
+            m_Capacity = rhs.m_Capacity;
+            m_SlotCount = rhs.m_SlotCount;
+            m_FreeHead = rhs.m_FreeHead;
+
+            rhs.reset();
+
+            return *this;
+        }
+
+        /**
+         * @brief Returns a const reference to the element referred to by handle @p h.
+         * Use update() or decrease_key() to change the element, since its position in the heap depends on it.
+         * @note A handle which is no longer valid will produce undefined behaviour.
+         * @param h The handle to the element. Must be valid.
+         * @return A const reference to the element.
+        */
+        const T& operator[](handle h) const noexcept { KTL_ASSERT(contains(h)); return m_Data[m_Slots[h.Index].Index]; }
+
+
+        const_iterator begin() const noexcept { return m_Data; }
+
+        const_iterator end() const noexcept { return m_Data + m_Size; }
+
+
+        /**
+         * @brief Returns a pointer to the start of the heap.
+         * @return A pointer to the start of the heap.
+        */
+        const T* data() const noexcept { return m_Data; }
+
+        /**
+         * @brief Returns the current size of the heap.
+         * @return The current size of the heap in number of elements.
+        */
+        size_t size() const noexcept { return m_Size; }
+
+        /**
+         * @brief Returns the current capacity of the heap.
+         * @return The current capacity of the heap in number of elements.
+        */
+        size_t capacity() const noexcept { return m_Capacity; }
+
+        /**
+         * @brief Returns true if the heap has no elements.
+         * @return Whether the heap has a size of 0.
+        */
+        bool empty() const noexcept { return m_Size == 0; }
+
+
+        /**
+         * @brief Returns whether the handle @p h still refers to an element in the heap.
+         * @param h The handle to check.
+         * @return Whether the element has not been popped or erased.
+        */
+        bool contains(handle h) const noexcept
+        {
+            return h.Index < m_SlotCount && m_Slots[h.Index].Generation == h.Generation;
+        }
+
+        /**
+         * @brief Returns a pointer to the element referred to by handle @p h.
+         * @param h The handle to the element.
+         * @return A pointer to the element or nullptr if it has been popped or erased.
+        */
+        const T* get(handle h) const noexcept
+        {
+            return contains(h) ? m_Data + m_Slots[h.Index].Index : nullptr;
+        }
+
+        /**
+         * @brief Returns the handle to the element at the given position, such as during iteration.
+         * @param iter An iterator pointing to the element. Must be less than end().
+         * @return The handle to the element.
+        */
+        handle get_handle(const_iterator iter) const noexcept
+        {
+            KTL_ASSERT(iter >= m_Data && iter < m_Data + m_Size);
+
+            uint32_t index = m_Owners[iter - m_Data];
+
+            return { index, m_Slots[index].Generation };
+        }
+
+
+        /**
+         * @brief Reserves the capacity of the heap to @p n, without constructing any elements.
+         * @param n The minimum capacity of the heap.
+        */
+        void reserve(size_t n) noexcept
+        {
+            if (m_Capacity < n)
+                set_size(n);
+        }
+
+        /**
+         * @brief Inserts a new element into the heap by copying it.
+         * @param value The element to copy into the heap.
+         * @return A handle to the element.
+        */
+        handle insert(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        {
+            return emplace(value);
+        }
+
+        /**
+         * @brief Inserts a new element into the heap by moving it.
+         * @param value The element to move into the heap.
+         * @return A handle to the element.
+        */
+        handle insert(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            return emplace(std::move(value));
+        }
+
+        /**
+         * @brief Inserts a new element into the heap by constructing it.
+         * @tparam ...Args Variadic template arguments.
+         * @param ...args Any arguments to use in the construction of the element.
+         * @return A handle to the element.
+        */
+        template<typename... Args>
+        handle emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+        {
+            if (m_Size == m_Capacity)
+                expand(1);
+
+            Traits::construct(m_Alloc, m_Data + m_Size, std::forward<Args>(args)...);
+
+            // Reuse a free slot, or add a new one at the end
+            uint32_t index = m_FreeHead;
+            if (index != INVALID)
+            {
+                m_FreeHead = m_Slots[index].Index;
+            }
+            else
+            {
+                index = uint32_t(m_SlotCount++);
+                m_Slots[index].Generation = 0;
+            }
+
+            place(m_Size, index);
+            percolateUp(m_Size++);
+
+            return { index, m_Slots[index].Generation };
+        }
+
+        /**
+         * @brief Peeks at the root element (lowest or highest, depending on min or max heap) and returns a const reference to it.
+         * @return A const reference to the root element.
+        */
+        const T& peek() const noexcept
+        {
+            KTL_ASSERT(m_Size > 0);
+
+            return m_Data[0];
+        }
+
+        /**
+         * @brief Returns the handle to the root element (lowest or highest, depending on min or max heap).
+         * @return The handle to the root element.
+        */
+        handle peek_handle() const noexcept
+        {
+            KTL_ASSERT(m_Size > 0);
+
+            return get_handle(m_Data);
+        }
+
+        /**
+         * @brief Removes the root element (lowest or highest, depending on min or max heap) and returns it.
+         * Any handles to it become invalid.
+         * @return The removed root element, returned by value.
+        */
+        T pop() noexcept
+        {
+            KTL_ASSERT(m_Size > 0);
+
+            T root = std::move(m_Data[0]);
+
+            erase_at(0);
+
+            return root;
+        }
+
+        /**
+         * @brief Replaces the element referred to by handle @p h with a value of higher priority, moving it towards the root.
+         * For a min heap this means a lower value and for a max heap a higher value. Takes O(log n) time.
+         * @param h The handle to the element. Must be valid.
+         * @param value The new value, which must not compare as lower priority than the old one.
+        */
+        template<typename V>
+        void decrease_key(handle h, V&& value) noexcept
+        {
+            KTL_ASSERT(contains(h));
+
+            size_t index = m_Slots[h.Index].Index;
+
+            KTL_ASSERT(!m_Comp(m_Data[index], value));
+
+            m_Data[index] = std::forward<V>(value);
+
+            percolateUp(index);
+        }
+
+        /**
+         * @brief Replaces the element referred to by handle @p h with any new value, moving it up or down in the heap. Takes O(log n) time.
+         * @param h The handle to the element. Must be valid.
+         * @param value The new value.
+        */
+        template<typename V>
+        void update(handle h, V&& value) noexcept
+        {
+            KTL_ASSERT(contains(h));
+
+            size_t index = m_Slots[h.Index].Index;
+
+            m_Data[index] = std::forward<V>(value);
+
+            restore(index);
+        }
+
+        /**
+         * @brief Erases the element referred to by handle @p h. Takes O(log n) time.
+         * @param h The handle to the element.
+         * @return Whether the element was erased. Returns false if the handle was no longer valid.
+        */
+        bool erase(handle h) noexcept
+        {
+            if (!contains(h))
+                return false;
+
+            erase_at(m_Slots[h.Index].Index);
+
+            return true;
+        }
+
+        /**
+         * @brief Erases all elements in the heap, invalidating all handles.
+        */
+        void clear() noexcept
+        {
+            for (size_t i = 0; i < m_Size; i++)
+            {
+                free_slot(m_Owners[i]);
+
+                Traits::destroy(m_Alloc, m_Data + i);
+            }
+
+            m_Size = 0;
+        }
+
+    private:
+        void place(size_t index, uint32_t owner) noexcept
+        {
+            m_Owners[index] = owner;
+            m_Slots[owner].Index = uint32_t(index);
+        }
+
+        void free_slot(uint32_t owner) noexcept
+        {
+            // Invalidate any handles to this slot, before reusing it
+            slot& erased = m_Slots[owner];
+            erased.Generation++;
+            erased.Index = m_FreeHead;
+            m_FreeHead = owner;
+        }
+
+        void erase_at(size_t index) noexcept
+        {
+            size_t last = m_Size - 1;
+
+            free_slot(m_Owners[index]);
+
+            // Move the last element into the hole and restore its position
+            if (index != last)
+            {
+                m_Data[index] = std::move(m_Data[last]);
+                place(index, m_Owners[last]);
+            }
+
+            Traits::destroy(m_Alloc, m_Data + last);
+            m_Size--;
+
+            if (index != last)
+                restore(index);
+        }
+
+        void restore(size_t index) noexcept
+        {
+            if (index != 0 && m_Comp(m_Data[index], m_Data[parent(index)]))
+                percolateUp(index);
+            else
+                percolateDown(index);
+        }
+
+        constexpr size_t parent(size_t index) const noexcept
+        {
+            return (index - 1) / Arity;
+        }
+
+        constexpr size_t child(size_t index) const noexcept
+        {
+            return index * Arity + 1;
+        }
+
+        size_t percolateUp(size_t index) noexcept
+        {
+            T value = std::move(m_Data[index]);
+            uint32_t owner = m_Owners[index];
+
+            while (index != 0 && m_Comp(value, m_Data[parent(index)]))
+            {
+                m_Data[index] = std::move(m_Data[parent(index)]);
+                place(index, m_Owners[parent(index)]);
+                index = parent(index);
+            }
+
+            m_Data[index] = std::move(value);
+            place(index, owner);
+
+            return index;
+        }
+
+        size_t percolateDown(size_t index) noexcept
+        {
+            T value = std::move(m_Data[index]);
+            uint32_t owner = m_Owners[index];
+
+            while (child(index) < m_Size)
+            {
+                size_t first = child(index);
+                size_t last = (std::min)(first + Arity, m_Size);
+
+                size_t best = first;
+                for (size_t i = first + 1; i < last; i++)
+                {
+                    if (m_Comp(m_Data[i], m_Data[best]))
+                        best = i;
+                }
+
+                if (!m_Comp(m_Data[best], value))
+                    break;
+
+                m_Data[index] = std::move(m_Data[best]);
+                place(index, m_Owners[best]);
+                index = best;
+            }
+
+            m_Data[index] = std::move(value);
+            place(index, owner);
+
+            return index;
+        }
+
+        void expand(size_t n) noexcept
+        {
+            size_t curCap = m_Capacity;
+            size_t alSize = curCap + (std::max)(curCap, n);
+
+            set_size(alSize);
+        }
+
+        void set_size(size_t n) noexcept
+        {
+            KTL_ASSERT(n < INVALID);
+
+            SlotAlloc slotAlloc(m_Alloc);
+            IndexAlloc indexAlloc(m_Alloc);
+
+            pointer data = Traits::allocate(m_Alloc, n);
+            index_pointer owners = IndexTraits::allocate(indexAlloc, n);
+            slot_pointer slots = SlotTraits::allocate(slotAlloc, n);
+
+            for (size_t i = 0; i < m_Size; i++)
+            {
+                Traits::construct(m_Alloc, data + i, std::move_if_noexcept(m_Data[i]));
+                Traits::destroy(m_Alloc, m_Data + i);
+            }
+
+            // The indices are trivial, so they can just be copied
+            for (size_t i = 0; i < m_Size; i++)
+                owners[i] = m_Owners[i];
+
+            for (size_t i = 0; i < m_SlotCount; i++)
+                slots[i] = m_Slots[i];
+
+            deallocate();
+
+            m_Data = data;
+            m_Owners = owners;
+            m_Slots = slots;
+            m_Capacity = n;
+        }
+
+        void copy_from(const indexed_heap& other)
+        {
+            if (other.m_Capacity == 0)
+                return;
+
+            set_size(other.m_Capacity);
+
+            for (size_t i = 0; i < other.m_Size; i++)
+            {
+                Traits::construct(m_Alloc, m_Data + i, other.m_Data[i]);
+                m_Owners[i] = other.m_Owners[i];
+            }
+
+            for (size_t i = 0; i < other.m_SlotCount; i++)
+                m_Slots[i] = other.m_Slots[i];
+
+            m_Size = other.m_Size;
+            m_SlotCount = other.m_SlotCount;
+            m_FreeHead = other.m_FreeHead;
+        }
+
+        void deallocate() noexcept
+        {
+            if (!m_Data)
+                return;
+
+            SlotAlloc slotAlloc(m_Alloc);
+            IndexAlloc indexAlloc(m_Alloc);
+
+            Traits::deallocate(m_Alloc, m_Data, m_Capacity);
+            IndexTraits::deallocate(indexAlloc, m_Owners, m_Capacity);
+            SlotTraits::deallocate(slotAlloc, m_Slots, m_Capacity);
+        }
+
+        void release() noexcept
+        {
+            for (size_t i = 0; i < m_Size; i++)
+                Traits::destroy(m_Alloc, m_Data + i);
+
+            deallocate();
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            m_Data = nullptr;
+            m_Owners = nullptr;
+            m_Slots = nullptr;
+            m_Size = 0;
+            m_Capacity = 0;
+            m_SlotCount = 0;
+            m_FreeHead = INVALID;
+        }
+
+    private:
+        KTL_EMPTY_BASE Alloc m_Alloc;
+        KTL_EMPTY_BASE Comp m_Comp;
+        pointer m_Data;
+        index_pointer m_Owners;
+        slot_pointer m_Slots;
+        size_t m_Size;
+        size_t m_Capacity;
+        size_t m_SlotCount;
+        uint32_t m_FreeHead;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <functional>
+
+namespace ktl
+{
+	template<typename T, typename Comp, typename Alloc = std::allocator<T>, size_t Arity = 2>
+	class indexed_heap;
+
+	/**
+	 * @brief An implementation of an indexed min heap, using std::less<T>
+	 * @tparam T The type to use. Must be move constructible and move assignable
+	 * @tparam Alloc The type of allocoator to use
+	*/
+	template<typename T, typename Alloc = std::allocator<T>>
+	using indexed_min_heap = indexed_heap<T, std::less<T>, Alloc>;
+
+	/**
+	 * @brief An implementation of an indexed max heap, using std::greater<T>
+	 * @tparam T The type to use. Must be move constructible and move assignable
+	 * @tparam Alloc The type of allocoator to use
+	*/
+	template<typename T, typename Alloc = std::allocator<T>>
+	using indexed_max_heap = indexed_heap<T, std::greater<T>, Alloc>;
+}
\ No newline at end of file
@@ -0,0 +1,352 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "object_pool_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+    /**
+     * @brief A pool of objects, which are allocated in cache-line aligned slabs and recycled when released.
+     * Free slots are linked outside of the object, so a released object is never overwritten.
+     * If a @p Reset hook is given, objects are kept constructed between uses, and the hook is called on them instead
+     * when they are acquired again. Otherwise objects are destroyed when released and constructed when acquired.
+     * @note Pointers to objects stay valid until they are released, the pool is cleared or the pool is destroyed
+     * @tparam T The type to use
+     * @tparam Alloc The type of allocator to use
+     * @tparam Reset A default constructible function object, called as Reset()(T&) when an object is recycled. Can be void
+     * @tparam SlabSize The amount of objects in each slab
+    */
+    template<typename T, typename Alloc, typename Reset, size_t SlabSize>
+    class object_pool
+    {
+    private:
+        static_assert(SlabSize > 0, "Slabs must contain at least 1 object");
+        static_assert(std::is_void_v<Reset> || std::is_invocable_v<Reset, T&>, "The reset hook must be callable with T&");
+
+        static constexpr bool KEEP_CONSTRUCTED = !std::is_void_v<Reset>;
+        static constexpr size_t CACHE_LINE = 64;
+
+        struct slot
+        {
+            alignas(T) unsigned char Data[sizeof(T)];
+            slot* Next;
+        };
+
+        struct alignas(CACHE_LINE) slab
+        {
+            slot Slots[SlabSize];
+            slab* Next;
+            void* Block;
+        };
+
+        // Slabs are over-allocated as bytes, so they can be aligned regardless of what the allocator guarantees
+        static constexpr size_t SLAB_ALIGNMENT = alignof(slab);
+        static constexpr size_t SLAB_BYTES = sizeof(slab) + SLAB_ALIGNMENT;
+
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<char> ByteAlloc;
+        typedef std::allocator_traits<ByteAlloc> Traits;
+
+        // Marks a slot as handed out, since live slots are never part of the free list
+        static inline slot* const LIVE = reinterpret_cast<slot*>(uintptr_t(1));
+
+    public:
+        /**
+         * @brief Construct the pool with the given allocator
+         * @param allocator The allocator to use. Will be default constructed if unspecified
+        */
+        explicit object_pool(const Alloc& allocator = Alloc()) noexcept :
+            m_Alloc(allocator),
+            m_Head(nullptr),
+            m_Tail(nullptr),
+            m_Current(nullptr),
+            m_Offset(SlabSize),
+            m_Used(0),
+            m_Constructed(0),
+            m_Free(nullptr),
+            m_Size(0) {}
+
+        object_pool(const object_pool&) = delete;
+
+        object_pool(object_pool&& other) noexcept :
+            m_Alloc(std::move(other.m_Alloc)),
+            m_Head(other.m_Head),
+            m_Tail(other.m_Tail),
+            m_Current(other.m_Current),
+            m_Offset(other.m_Offset),
+            m_Used(other.m_Used),
+            m_Constructed(other.m_Constructed),
+            m_Free(other.m_Free),
+            m_Size(other.m_Size)
+        {
+            other.m_Head = nullptr;
+            other.m_Tail = nullptr;
+            other.m_Current = nullptr;
+            other.m_Offset = SlabSize;
+            other.m_Used = 0;
+            other.m_Constructed = 0;
+            other.m_Free = nullptr;
+            other.m_Size = 0;
+        }
+
+        ~object_pool()
+        {
+            release_all();
+        }
+
+        object_pool& operator=(const object_pool&) = delete;
+
+        object_pool& operator=(object_pool&& rhs) noexcept
+        {
+            release_all();
+
+            m_Alloc = std::move(rhs.m_Alloc);
+            m_Head = rhs.m_Head;
+            m_Tail = rhs.m_Tail;
+            m_Current = rhs.m_Current;
+            m_Offset = rhs.m_Offset;
+            m_Used = rhs.m_Used;
+            m_Constructed = rhs.m_Constructed;
+            m_Free = rhs.m_Free;
+            m_Size = rhs.m_Size;
+
+            rhs.m_Head = nullptr;
+            rhs.m_Tail = nullptr;
+            rhs.m_Current = nullptr;
+            rhs.m_Offset = SlabSize;
+            rhs.m_Used = 0;
+            rhs.m_Constructed = 0;
+            rhs.m_Free = nullptr;
+            rhs.m_Size = 0;
+
+            return *this;
+        }
+
+        /**
+         * @brief Returns the amount of objects currently acquired from the pool
+         * @return The amount of live objects
+        */
+        size_t size() const noexcept { return m_Size; }
+
+        /**
+         * @brief Returns the amount of objects the pool can hold without allocating another slab
+         * @return The total amount of slots in all slabs
+        */
+        size_t capacity() const noexcept
+        {
+            size_t count = 0;
+            for (slab* current = m_Head; current; current = current->Next)
+                count += SlabSize;
+            return count;
+        }
+
+        /**
+         * @brief Returns true if no objects are currently acquired
+         * @return Whether size() is 0
+        */
+        bool empty() const noexcept { return m_Size == 0; }
+
+        /**
+         * @brief Acquires an object from the pool, reusing a released one if possible.
+         * If a reset hook is used, a recycled object is reset instead of constructed, and @p args are ignored.
+         * @tparam ...Args The types of the arguments
+         * @param ...args The arguments to construct the object with, if it has to be constructed
+         * @return A pointer to the object or nullptr if a slab could not be allocated
+        */
+        template<typename... Args>
+        T* acquire(Args&&... args)
+        {
+            slot* current = m_Free;
+
+            if (current)
+            {
+                if constexpr (KEEP_CONSTRUCTED)
+                    Reset()(*reinterpret_cast<T*>(current->Data));
+                else
+                    ::new(current->Data) T(std::forward<Args>(args)...);
+
+                m_Free = current->Next;
+            }
+            else
+            {
+                if (m_Offset == SlabSize)
+                {
+                    if (!next_slab())
+                        return nullptr;
+                }
+
+                current = m_Current->Slots + m_Offset;
+
+                // Slots below the watermark are still constructed from an earlier use
+                if (KEEP_CONSTRUCTED && m_Used < m_Constructed)
+                {
+                    if constexpr (KEEP_CONSTRUCTED)
+                        Reset()(*reinterpret_cast<T*>(current->Data));
+                }
+                else
+                {
+                    ::new(current->Data) T(std::forward<Args>(args)...);
+                }
+
+                m_Offset++;
+                m_Used++;
+
+                if (m_Used > m_Constructed)
+                    m_Constructed = m_Used;
+            }
+
+            current->Next = LIVE;
+            m_Size++;
+
+            return reinterpret_cast<T*>(current->Data);
+        }
+
+        /**
+         * @brief Releases an object back into the pool.
+         * If a reset hook is used, the object is kept alive until it is acquired again. Otherwise it is destroyed.
+         * @param p A pointer to an object acquired from this pool
+        */
+        void release(T* p) noexcept
+        {
+            KTL_ASSERT(p != nullptr);
+
+            slot* current = reinterpret_cast<slot*>(p);
+
+            KTL_ASSERT(current->Next == LIVE);
+
+            if constexpr (!KEEP_CONSTRUCTED)
+                p->~T();
+
+            current->Next = m_Free;
+            m_Free = current;
+            m_Size--;
+        }
+
+        /**
+         * @brief Releases every object in the pool at once, without deallocating any slabs.
+         * Takes O(1) time if a reset hook is used or T is trivially destructible, since nothing has to be destroyed
+        */
+        void clear() noexcept
+        {
+            if constexpr (!KEEP_CONSTRUCTED && !std::is_trivially_destructible_v<T>)
+                destroy_live();
+
+            // Everything below the watermark stays constructed if needed, so just rewind
+            m_Current = m_Head;
+            m_Offset = m_Head ? 0 : SlabSize;
+            m_Used = 0;
+            m_Free = nullptr;
+            m_Size = 0;
+
+            if constexpr (!KEEP_CONSTRUCTED)
+                m_Constructed = 0;
+        }
+
+    private:
+        bool next_slab()
+        {
+            // Reuse slabs that were rewound by clear()
+            if (m_Current && m_Current->Next)
+            {
+                m_Current = m_Current->Next;
+                m_Offset = 0;
+                return true;
+            }
+
+            char* block = Traits::allocate(m_Alloc, SLAB_BYTES);
+
+            if (!block)
+                return false;
+
+            uintptr_t address = reinterpret_cast<uintptr_t>(block);
+            uintptr_t aligned = (address + SLAB_ALIGNMENT - 1) & ~uintptr_t(SLAB_ALIGNMENT - 1);
+
+            slab* next = reinterpret_cast<slab*>(aligned);
+            next->Next = nullptr;
+            next->Block = block;
+
+            if (m_Tail)
+                m_Tail->Next = next;
+            else
+                m_Head = next;
+
+            m_Tail = next;
+            m_Current = next;
+            m_Offset = 0;
+
+            return true;
+        }
+
+        template<typename Func>
+        void for_each_constructed(Func func) noexcept
+        {
+            size_t remaining = m_Constructed;
+            for (slab* current = m_Head; current && remaining > 0; current = current->Next)
+            {
+                size_t count = remaining < SlabSize ? remaining : SlabSize;
+                for (size_t i = 0; i < count; i++)
+                    func(current->Slots[i]);
+                remaining -= count;
+            }
+        }
+
+        void destroy_live() noexcept
+        {
+            // Without a reset hook, only the slots that are handed out hold objects
+            for_each_constructed([](slot& current)
+            {
+                if (current.Next == LIVE)
+                    reinterpret_cast<T*>(current.Data)->~T();
+            });
+        }
+
+        void release_all() noexcept
+        {
+            if constexpr (KEEP_CONSTRUCTED)
+            {
+                for_each_constructed([](slot& current)
+                {
+                    reinterpret_cast<T*>(current.Data)->~T();
+                });
+            }
+            else if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                destroy_live();
+            }
+
+            slab* current = m_Head;
+            while (current)
+            {
+                slab* next = current->Next;
+                Traits::deallocate(m_Alloc, static_cast<char*>(current->Block), SLAB_BYTES);
+                current = next;
+            }
+
+            m_Head = nullptr;
+            m_Tail = nullptr;
+            m_Current = nullptr;
+            m_Offset = SlabSize;
+            m_Used = 0;
+            m_Constructed = 0;
+            m_Free = nullptr;
+            m_Size = 0;
+        }
+
+    private:
+        KTL_EMPTY_BASE ByteAlloc m_Alloc;
+        slab* m_Head;
+        slab* m_Tail;
+        slab* m_Current;
+        size_t m_Offset;
+        size_t m_Used;
+        size_t m_Constructed;
+        slot* m_Free;
+        size_t m_Size;
+    };
+}
\ No newline at end of file
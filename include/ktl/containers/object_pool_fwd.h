@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace ktl
+{
+    template<typename T, typename Alloc = std::allocator<T>, typename Reset = void, size_t SlabSize = 64>
+    class object_pool;
+}
\ No newline at end of file
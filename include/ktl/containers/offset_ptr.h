@@ -0,0 +1,132 @@
+#pragma once
+
+#include "offset_ptr_fwd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief A pointer which stores the distance from itself to the object it points to, instead of its address.
+	 * As long as the pointer and the object it points to are moved together, like when a memory-mapped file is mapped at a different address,
+	 * the pointer stays valid. This makes it possible to store data structures in shared or persistent memory.
+	 * @note Converts implicitly to and from T*, so it can be used as the pointer type of an allocator
+	 * @tparam T The type to point to
+	*/
+	template<typename T>
+	class offset_ptr
+	{
+	private:
+		// An offset of 1 would point into the pointer itself, so it is used to represent nullptr
+		static constexpr std::ptrdiff_t NULL_OFFSET = 1;
+
+	public:
+		typedef T element_type;
+		typedef std::ptrdiff_t difference_type;
+
+		offset_ptr() noexcept :
+			m_Offset(NULL_OFFSET) {}
+
+		offset_ptr(std::nullptr_t) noexcept :
+			m_Offset(NULL_OFFSET) {}
+
+		offset_ptr(T* p) noexcept :
+			m_Offset(to_offset(p)) {}
+
+		// The offset is relative to this object, so it has to be recalculated when copying
+		offset_ptr(const offset_ptr& other) noexcept :
+			m_Offset(to_offset(other.get())) {}
+
+		template<typename U,
+			typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		offset_ptr(const offset_ptr<U>& other) noexcept :
+			m_Offset(to_offset(other.get())) {}
+
+		offset_ptr& operator=(const offset_ptr& rhs) noexcept
+		{
+			m_Offset = to_offset(rhs.get());
+
+			return *this;
+		}
+
+		offset_ptr& operator=(T* p) noexcept
+		{
+			m_Offset = to_offset(p);
+
+			return *this;
+		}
+
+		offset_ptr& operator=(std::nullptr_t) noexcept
+		{
+			m_Offset = NULL_OFFSET;
+
+			return *this;
+		}
+
+		/**
+		 * @brief Returns the address this pointer points to
+		 * @return The address of the object, or nullptr
+		*/
+		T* get() const noexcept
+		{
+			if (m_Offset == NULL_OFFSET)
+				return nullptr;
+
+			return reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(this) + m_Offset);
+		}
+
+		operator T*() const noexcept { return get(); }
+
+		T* operator->() const noexcept { return get(); }
+
+		std::add_lvalue_reference_t<T> operator*() const noexcept { return *get(); }
+
+		offset_ptr& operator+=(difference_type n) noexcept
+		{
+			return *this = get() + n;
+		}
+
+		offset_ptr& operator-=(difference_type n) noexcept
+		{
+			return *this = get() - n;
+		}
+
+		offset_ptr& operator++() noexcept
+		{
+			return *this += 1;
+		}
+
+		offset_ptr operator++(int) noexcept
+		{
+			T* p = get();
+			*this += 1;
+			return p;
+		}
+
+		offset_ptr& operator--() noexcept
+		{
+			return *this -= 1;
+		}
+
+		offset_ptr operator--(int) noexcept
+		{
+			T* p = get();
+			*this -= 1;
+			return p;
+		}
+
+	private:
+		std::ptrdiff_t to_offset(T* p) const noexcept
+		{
+			if (!p)
+				return NULL_OFFSET;
+
+			return std::ptrdiff_t(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(this));
+		}
+
+	private:
+		std::ptrdiff_t m_Offset;
+	};
+}
\ No newline at end of file
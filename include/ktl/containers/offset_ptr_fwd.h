@@ -0,0 +1,8 @@
+#pragma once
+
+namespace ktl
+{
+	// A pointer which stores the distance to its target, rather than the address
+	template<typename T>
+	class offset_ptr;
+}
\ No newline at end of file
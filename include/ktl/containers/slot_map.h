@@ -0,0 +1,483 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "slot_map_fwd.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+    /**
+     * @brief A container which stores its objects densely in a single array and hands out handles to them, rather than pointers.
+     * A handle consists of an index into a table of slots and a generation, which is incremented every time the slot is reused,
+     * so a handle to an erased object is detected, rather than pointing to whatever took its place.
+     * Inserting, erasing and looking up objects takes O(1) time, and iterating goes over contiguous memory.
+     * @note Erasing moves the last object into the erased object's place, so pointers and iterators are not stable, but handles are
+     * @tparam T The type to use. Must be move constructible and move assignable
+     * @tparam Alloc The type of allocator to use
+    */
+    template<typename T, typename Alloc>
+    class slot_map
+    {
+    private:
+        static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
+        static_assert(std::is_move_assignable_v<T>, "T must be move assignable");
+
+        static constexpr uint32_t INVALID = UINT32_MAX;
+
+        struct slot
+        {
+            // The index of the object if the slot is in use, otherwise the next free slot
+            uint32_t Index;
+            uint32_t Generation;
+        };
+
+        typedef std::allocator_traits<Alloc> Traits;
+        typedef typename Traits::template rebind_alloc<slot> SlotAlloc;
+        typedef std::allocator_traits<SlotAlloc> SlotTraits;
+        typedef typename Traits::template rebind_alloc<uint32_t> IndexAlloc;
+        typedef std::allocator_traits<IndexAlloc> IndexTraits;
+
+    public:
+        typedef T* iterator;
+        typedef const T* const_iterator;
+
+        /**
+         * @brief A handle to an object in the map, which stays valid until the object is erased
+        */
+        struct handle
+        {
+            uint32_t Index = INVALID;
+            uint32_t Generation = 0;
+
+            bool operator==(const handle& rhs) const noexcept
+            {
+                return Index == rhs.Index && Generation == rhs.Generation;
+            }
+
+            bool operator!=(const handle& rhs) const noexcept
+            {
+                return Index != rhs.Index || Generation != rhs.Generation;
+            }
+        };
+
+    public:
+        /**
+         * @brief Construct the map with the given allocator
+         * @param allocator The allocator to use. Will be default constructed if unspecified
+        */
+        explicit slot_map(const Alloc& allocator = Alloc()) noexcept :
+            m_Alloc(allocator),
+            m_Data(nullptr),
+            m_Owners(nullptr),
+            m_Slots(nullptr),
+            m_Size(0),
+            m_Capacity(0),
+            m_SlotCount(0),
+            m_FreeHead(INVALID) {}
+
+        /**
+         * @brief Construct the map with the given allocator and initial capacity
+         * @param capacity The initial capacity of the map
+         * @param allocator The allocator to use. Will be default constructed if unspecified
+        */
+        explicit slot_map(size_t capacity, const Alloc& allocator = Alloc()) noexcept :
+            slot_map(allocator)
+        {
+            reserve(capacity);
+        }
+
+        slot_map(const slot_map& other) :
+            m_Alloc(Traits::select_on_container_copy_construction(other.m_Alloc)),
+            m_Data(nullptr),
+            m_Owners(nullptr),
+            m_Slots(nullptr),
+            m_Size(0),
+            m_Capacity(0),
+            m_SlotCount(0),
+            m_FreeHead(INVALID)
+        {
+            copy_from(other);
+        }
+
+        slot_map(slot_map&& other) noexcept :
+            m_Alloc(std::move(other.m_Alloc)),
+            m_Data(other.m_Data),
+            m_Owners(other.m_Owners),
+            m_Slots(other.m_Slots),
+            m_Size(other.m_Size),
+            m_Capacity(other.m_Capacity),
+            m_SlotCount(other.m_SlotCount),
+            m_FreeHead(other.m_FreeHead)
+        {
+            other.reset();
+        }
+
+        ~slot_map() noexcept
+        {
+            release();
+        }
+
+        slot_map& operator=(const slot_map& rhs)
+        {
+            if (this == &rhs)
+                return *this;
+
+            release();
+
+            m_Alloc = rhs.m_Alloc;
+
+            copy_from(rhs);
+
+            return *this;
+        }
+
+        slot_map& operator=(slot_map&& rhs) noexcept
+        {
+            if (this == &rhs)
+                return *this;
+
+            release();
+
+            m_Alloc = std::move(rhs.m_Alloc);
+            m_Data = rhs.m_Data;
+            m_Owners = rhs.m_Owners;
+            m_Slots = rhs.m_Slots;
+            m_Size = rhs.m_Size;
+            m_Capacity = rhs.m_Capacity;
+            m_SlotCount = rhs.m_SlotCount;
+            m_FreeHead = rhs.m_FreeHead;
+
+            rhs.reset();
+
+            return *this;
+        }
+
+        /**
+         * @brief Returns a reference to the object referred to by handle @p h.
+         * @note A handle which is no longer valid will produce undefined behaviour.
+         * @param h The handle to the object. Must be valid.
+         * @return A reference to the object.
+        */
+        T& operator[](handle h) noexcept { KTL_ASSERT(contains(h)); return m_Data[m_Slots[h.Index].Index]; }
+
+        /**
+         * @brief Returns a reference to the object referred to by handle @p h.
+         * @note A handle which is no longer valid will produce undefined behaviour.
+         * @param h The handle to the object. Must be valid.
+         * @return A reference to the object.
+        */
+        const T& operator[](handle h) const noexcept { KTL_ASSERT(contains(h)); return m_Data[m_Slots[h.Index].Index]; }
+
+
+        iterator begin() noexcept { return m_Data; }
+
+        const_iterator begin() const noexcept { return m_Data; }
+
+        iterator end() noexcept { return m_Data + m_Size; }
+
+        const_iterator end() const noexcept { return m_Data + m_Size; }
+
+
+        /**
+         * @brief Returns the current amount of objects in the map.
+         * @return The current amount of objects.
+        */
+        size_t size() const noexcept { return m_Size; }
+
+        /**
+         * @brief Returns the amount of objects the map can hold without reallocating.
+         * @return The current capacity of the map.
+        */
+        size_t capacity() const noexcept { return m_Capacity; }
+
+        /**
+         * @brief Returns true if the map has no objects.
+         * @return Whether the map has a size of 0.
+        */
+        bool empty() const noexcept { return m_Size == 0; }
+
+        /**
+         * @brief Returns a pointer to the start of the contiguous array of objects.
+         * @return A pointer to the first object.
+        */
+        T* data() noexcept { return m_Data; }
+
+        /**
+         * @brief Returns a pointer to the start of the contiguous array of objects.
+         * @return A pointer to the first object.
+        */
+        const T* data() const noexcept { return m_Data; }
+
+
+        /**
+         * @brief Returns whether the handle @p h still refers to an object in the map.
+         * @param h The handle to check.
+         * @return Whether the object has not been erased.
+        */
+        bool contains(handle h) const noexcept
+        {
+            return h.Index < m_SlotCount && m_Slots[h.Index].Generation == h.Generation;
+        }
+
+        /**
+         * @brief Returns a pointer to the object referred to by handle @p h.
+         * @param h The handle to the object.
+         * @return A pointer to the object or nullptr if it has been erased.
+        */
+        T* get(handle h) noexcept
+        {
+            return contains(h) ? m_Data + m_Slots[h.Index].Index : nullptr;
+        }
+
+        /**
+         * @brief Returns a pointer to the object referred to by handle @p h.
+         * @param h The handle to the object.
+         * @return A pointer to the object or nullptr if it has been erased.
+        */
+        const T* get(handle h) const noexcept
+        {
+            return contains(h) ? m_Data + m_Slots[h.Index].Index : nullptr;
+        }
+
+        /**
+         * @brief Returns the handle to the object at the given position, such as during iteration.
+         * @param iter An iterator pointing to the object. Must be less than end().
+         * @return The handle to the object.
+        */
+        handle get_handle(const_iterator iter) const noexcept
+        {
+            KTL_ASSERT(iter >= m_Data && iter < m_Data + m_Size);
+
+            uint32_t index = m_Owners[iter - m_Data];
+
+            return { index, m_Slots[index].Generation };
+        }
+
+
+        /**
+         * @brief Reserves the capacity of the map to @p n, without constructing any objects.
+         * @param n The minimum capacity of the map.
+        */
+        void reserve(size_t n) noexcept
+        {
+            if (m_Capacity < n)
+                set_size(n);
+        }
+
+        /**
+         * @brief Inserts a new object into the map by copying it.
+         * @param value The object to copy into the map.
+         * @return A handle to the object.
+        */
+        handle insert(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        {
+            return emplace(value);
+        }
+
+        /**
+         * @brief Inserts a new object into the map by moving it.
+         * @param value The object to move into the map.
+         * @return A handle to the object.
+        */
+        handle insert(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            return emplace(std::move(value));
+        }
+
+        /**
+         * @brief Inserts a new object into the map by constructing it.
+         * @tparam ...Args Variadic template arguments.
+         * @param ...args Any arguments to use in the construction of the object.
+         * @return A handle to the object.
+        */
+        template<typename... Args>
+        handle emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+        {
+            if (m_Size == m_Capacity)
+                expand(1);
+
+            Traits::construct(m_Alloc, m_Data + m_Size, std::forward<Args>(args)...);
+
+            // Reuse a free slot, or add a new one at the end
+            uint32_t index = m_FreeHead;
+            if (index != INVALID)
+            {
+                m_FreeHead = m_Slots[index].Index;
+            }
+            else
+            {
+                index = uint32_t(m_SlotCount++);
+                m_Slots[index].Generation = 0;
+            }
+
+            m_Slots[index].Index = uint32_t(m_Size);
+            m_Owners[m_Size] = index;
+            m_Size++;
+
+            return { index, m_Slots[index].Generation };
+        }
+
+        /**
+         * @brief Erases the object referred to by handle @p h, moving the last object into its place.
+         * @param h The handle to the object.
+         * @return Whether the object was erased. Returns false if the handle was no longer valid.
+        */
+        bool erase(handle h) noexcept
+        {
+            if (!contains(h))
+                return false;
+
+            slot& erased = m_Slots[h.Index];
+            size_t position = erased.Index;
+            size_t last = m_Size - 1;
+
+            // Keep the objects dense by moving the last one into the hole
+            if (position != last)
+            {
+                m_Data[position] = std::move(m_Data[last]);
+                m_Owners[position] = m_Owners[last];
+                m_Slots[m_Owners[position]].Index = uint32_t(position);
+            }
+
+            Traits::destroy(m_Alloc, m_Data + last);
+            m_Size--;
+
+            // Invalidate any handles to this slot, before reusing it
+            erased.Generation++;
+            erased.Index = m_FreeHead;
+            m_FreeHead = h.Index;
+
+            return true;
+        }
+
+        /**
+         * @brief Erases all objects in the map, invalidating all handles.
+        */
+        void clear() noexcept
+        {
+            for (size_t i = 0; i < m_Size; i++)
+            {
+                slot& current = m_Slots[m_Owners[i]];
+                current.Generation++;
+                current.Index = m_FreeHead;
+                m_FreeHead = m_Owners[i];
+
+                Traits::destroy(m_Alloc, m_Data + i);
+            }
+
+            m_Size = 0;
+        }
+
+    private:
+        void expand(size_t n) noexcept
+        {
+            size_t curCap = m_Capacity;
+            size_t alSize = curCap + (std::max)(curCap / 2, n);
+
+            set_size(alSize);
+        }
+
+        void set_size(size_t n) noexcept
+        {
+            KTL_ASSERT(n < INVALID);
+
+            SlotAlloc slotAlloc(m_Alloc);
+            IndexAlloc indexAlloc(m_Alloc);
+
+            T* data = Traits::allocate(m_Alloc, n);
+            uint32_t* owners = IndexTraits::allocate(indexAlloc, n);
+            slot* slots = SlotTraits::allocate(slotAlloc, n);
+
+            for (size_t i = 0; i < m_Size; i++)
+            {
+                Traits::construct(m_Alloc, data + i, std::move_if_noexcept(m_Data[i]));
+                Traits::destroy(m_Alloc, m_Data + i);
+            }
+
+            // The indices are trivial, so they can just be copied
+            for (size_t i = 0; i < m_Size; i++)
+                owners[i] = m_Owners[i];
+
+            for (size_t i = 0; i < m_SlotCount; i++)
+                slots[i] = m_Slots[i];
+
+            deallocate();
+
+            m_Data = data;
+            m_Owners = owners;
+            m_Slots = slots;
+            m_Capacity = n;
+        }
+
+        void copy_from(const slot_map& other)
+        {
+            if (other.m_Capacity == 0)
+                return;
+
+            set_size(other.m_Capacity);
+
+            for (size_t i = 0; i < other.m_Size; i++)
+            {
+                Traits::construct(m_Alloc, m_Data + i, other.m_Data[i]);
+                m_Owners[i] = other.m_Owners[i];
+            }
+
+            for (size_t i = 0; i < other.m_SlotCount; i++)
+                m_Slots[i] = other.m_Slots[i];
+
+            m_Size = other.m_Size;
+            m_SlotCount = other.m_SlotCount;
+            m_FreeHead = other.m_FreeHead;
+        }
+
+        void deallocate() noexcept
+        {
+            if (!m_Data)
+                return;
+
+            SlotAlloc slotAlloc(m_Alloc);
+            IndexAlloc indexAlloc(m_Alloc);
+
+            Traits::deallocate(m_Alloc, m_Data, m_Capacity);
+            IndexTraits::deallocate(indexAlloc, m_Owners, m_Capacity);
+            SlotTraits::deallocate(slotAlloc, m_Slots, m_Capacity);
+        }
+
+        void release() noexcept
+        {
+            for (size_t i = 0; i < m_Size; i++)
+                Traits::destroy(m_Alloc, m_Data + i);
+
+            deallocate();
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            m_Data = nullptr;
+            m_Owners = nullptr;
+            m_Slots = nullptr;
+            m_Size = 0;
+            m_Capacity = 0;
+            m_SlotCount = 0;
+            m_FreeHead = INVALID;
+        }
+
+    private:
+        KTL_EMPTY_BASE Alloc m_Alloc;
+        T* m_Data;
+        uint32_t* m_Owners;
+        slot* m_Slots;
+        size_t m_Size;
+        size_t m_Capacity;
+        size_t m_SlotCount;
+        uint32_t m_FreeHead;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <memory>
+
+namespace ktl
+{
+    template<typename T, typename Alloc = std::allocator<T>>
+    class slot_map;
+}
\ No newline at end of file
@@ -0,0 +1,520 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "small_vector_fwd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief A vector of trivial types, which stores up to @p N elements inline, before it allocates any memory.
+	 * Once it outgrows its inline storage the elements are moved to memory from the allocator, like a trivial_vector.
+	 * @note Moving a vector which uses its inline storage copies the elements, so iterators are not preserved
+	 * @tparam T The type to use. Must be trivially copyable and default constructible
+	 * @tparam N The amount of elements to store inline
+	 * @tparam Alloc The type of allocator to use
+	*/
+	template<typename T, size_t N, typename Alloc>
+	class small_vector
+	{
+	private:
+		static_assert(std::is_default_constructible<T>::value, "Template class needs to be default constructible");
+		static_assert(std::is_trivially_copyable<T>::value, "Template class needs to be trivially copyable");
+		static_assert(N > 0, "The inline capacity must be at least 1. Use trivial_vector otherwise");
+
+		typedef std::allocator_traits<Alloc> Traits;
+
+	public:
+		typedef T* iterator;
+		typedef const T* const_iterator;
+
+		typedef std::reverse_iterator<T*> reverse_iterator;
+		typedef std::reverse_iterator<const T*> const_reverse_iterator;
+
+	public:
+		/**
+		 * @brief Construct the vector with a default constructed allocator
+		*/
+		small_vector() noexcept :
+			m_Alloc(),
+			m_Begin(inline_data()),
+			m_End(m_Begin),
+			m_EndMax(m_Begin + N) {}
+
+		/**
+		 * @brief Construct the vector with the given allocator
+		 * @param allocator The allocator to use
+		*/
+		explicit small_vector(const Alloc& allocator) noexcept :
+			m_Alloc(allocator),
+			m_Begin(inline_data()),
+			m_End(m_Begin),
+			m_EndMax(m_Begin + N) {}
+
+		/**
+		 * @brief Construct the vector with the given allocator and initial size
+		 * @param n The initial size of the vector
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit small_vector(size_t n, const Alloc& allocator = Alloc()) noexcept :
+			small_vector(allocator)
+		{
+			resize(n);
+		}
+
+		/**
+		 * @brief Construct the vector with the given allocator, initial size and default value
+		 * @param n The initial size of the vector
+		 * @param value The value to initialize every element as
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit small_vector(size_t n, const T& value, const Alloc& allocator = Alloc()) noexcept :
+			small_vector(allocator)
+		{
+			resize(n);
+
+			std::uninitialized_fill_n<T*, size_t>(m_Begin, n, value);
+		}
+
+		/**
+		 * @brief Construct the vector with the allocator and range of values
+		 * @param initializer The initial set of values
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		small_vector(std::initializer_list<T> initializer, const Alloc& allocator = Alloc()) noexcept :
+			small_vector(initializer.begin(), initializer.end(), allocator) {}
+
+		/**
+		 * @brief Construct the vector with the allocator and range of values
+		 * @param first A pointer to the first element
+		 * @param last A pointer past the last element
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit small_vector(const T* first, const T* last, const Alloc& allocator = Alloc()) noexcept :
+			small_vector(allocator)
+		{
+			push_back(first, last);
+		}
+
+		small_vector(const small_vector& other) noexcept :
+			small_vector(Traits::select_on_container_copy_construction(static_cast<Alloc>(other.m_Alloc)))
+		{
+			push_back(other.m_Begin, other.m_End);
+		}
+
+		small_vector(small_vector&& other) noexcept :
+			small_vector(std::move(other.m_Alloc))
+		{
+			steal(other);
+		}
+
+		small_vector(const small_vector& other, const Alloc& allocator) noexcept :
+			small_vector(allocator)
+		{
+			push_back(other.m_Begin, other.m_End);
+		}
+
+		small_vector(small_vector&& other, const Alloc& allocator) noexcept :
+			small_vector(allocator)
+		{
+			// Moving using a different allocator means we can't just move, we have to reallocate
+			push_back(other.m_Begin, other.m_End);
+
+			other.release();
+		}
+
+		~small_vector() noexcept
+		{
+			if (!is_inline())
+				Traits::deallocate(m_Alloc, m_Begin, capacity());
+		}
+
+		small_vector& operator=(const small_vector& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Alloc = other.m_Alloc;
+
+			push_back(other.m_Begin, other.m_End);
+
+			return *this;
+		}
+
+		small_vector& operator=(small_vector&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Alloc = std::move(other.m_Alloc);
+
+			steal(other);
+
+			return *this;
+		}
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the array. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		T& operator[](size_t index) noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the array. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		const T& operator[](size_t index) const noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+
+		iterator begin() noexcept { return m_Begin; }
+
+		const_iterator begin() const noexcept { return m_Begin; }
+
+		iterator end() noexcept { return m_End; }
+
+		const_iterator end() const noexcept { return m_End; }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+		/**
+		 * @brief Returns the current size of the vector.
+		 * @return The current size of the vector in number of elements.
+		*/
+		size_t size() const noexcept { return m_End - m_Begin; }
+
+		/**
+		 * @brief Returns the current capacity of the vector.
+		 * @return The current capacity of the vector in number of elements.
+		*/
+		size_t capacity() const noexcept { return m_EndMax - m_Begin; }
+
+		/**
+		 * @brief Returns true if the vector has no elements.
+		 * @return Whether the vector has a size of 0.
+		*/
+		bool empty() const noexcept { return m_Begin == m_End; }
+
+		/**
+		 * @brief Returns true if the elements are stored inline, rather than in allocated memory.
+		 * @return Whether the vector has not allocated any memory.
+		*/
+		bool is_inline() const noexcept { return m_Begin == inline_data(); }
+
+
+		/**
+		 * @brief Returns an iterator to the start of the vector.
+		 * @return An iterator to the start of the vector.
+		*/
+		iterator data() noexcept { return m_Begin; }
+
+		/**
+		 * @brief Returns a const iterator to the start of the vector.
+		 * @return A const iterator to the start of the vector.
+		*/
+		const_iterator data() const noexcept { return m_Begin; }
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the vector. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		T& at(size_t index) const noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+
+		/**
+		 * @brief Resizes the vector to the given size.
+		 * @param n The size to resize to.
+		*/
+		void resize(size_t n) noexcept
+		{
+			if (capacity() < n)
+				expand(n - capacity());
+
+			m_End = m_Begin + n;
+		}
+
+		/**
+		 * @brief Reserves the capacity of the vector to @p n, without initializing any elements.
+		 * @param n The minimum capacity of the vector.
+		*/
+		void reserve(size_t n) noexcept
+		{
+			if (capacity() < n)
+				set_size(n);
+		}
+
+		/**
+		 * @brief Moves the elements back into the inline storage if they fit, or into a smaller allocation otherwise.
+		*/
+		void shrink_to_fit() noexcept
+		{
+			if (!is_inline() && capacity() > size())
+				set_size(size());
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by copying it.
+		 * @param value The element to copy into the vector.
+		 * @return An iterator to the element that was added.
+		*/
+		iterator push_back(const T& element) noexcept
+		{
+			if (m_End == m_EndMax)
+				expand(1);
+			*m_End = element;
+
+			return m_End++;
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by moving it.
+		 * @param value The element to move into the vector.
+		 * @return An iterator to the element that was added.
+		*/
+		iterator push_back(T&& element) noexcept
+		{
+			if (m_End == m_EndMax)
+				expand(1);
+			*m_End = std::move(element);
+
+			return m_End++;
+		}
+
+		/**
+		 * @brief Pushes a range of values into the vector.
+		 * @param first A pointer to the first element.
+		 * @param last A pointer one element past the last element.
+		 * @return An iterator to the element that was added.
+		*/
+		iterator push_back(const T* first, const T* last) noexcept
+		{
+			const size_t n = (last - first);
+
+			if (size_t(m_EndMax - m_End) < n)
+				expand(n);
+
+			T* lastElement = m_End;
+			m_End += n;
+
+			if (n > 0)
+				std::memcpy(lastElement, first, n * sizeof(T));
+
+			return lastElement;
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by constructing it.
+		 * @tparam ...Args Variadic template arguments.
+		 * @param ...args Any arguments to use in the construction of the element.
+		 * @return An iterator to the element that was added.
+		*/
+		template<typename... Args>
+		iterator emplace_back(Args&&... args) noexcept
+		{
+			if (m_End == m_EndMax)
+				expand(1);
+			*m_End = T(std::forward<Args>(args)...);
+
+			return m_End++;
+		}
+
+		/**
+		 * @brief Inserts a new element into the vector at the given location by constructing it.
+		 * @tparam ...Args Variadic template arguments.
+		 * @param iter An iterator pointing to the location to insert the element at.
+		 * @param ...args Any arguments to use in the construction of the element.
+		 * @return An iterator to the element that was added.
+		*/
+		template<typename... Args>
+		iterator emplace(const_iterator iter, Args&&... args) noexcept
+		{
+			KTL_ASSERT(iter >= m_Begin && iter <= m_End);
+
+			// The iterator is invalidated if we reallocate
+			size_t index = iter - m_Begin;
+
+			if (m_End == m_EndMax)
+				expand(1);
+
+			T* element = m_Begin + index;
+
+			std::memmove(element + 1, element, (m_End - element) * sizeof(T));
+
+			*element = T(std::forward<Args>(args)...);
+			m_End++;
+
+			return element;
+		}
+
+		/**
+		 * @brief Erases the element pointed to by the iterator.
+		 * @param iter An iterator pointing to the element.
+		 * @return An iterator pointing to the element immidiately after the erased one.
+		*/
+		iterator erase(const_iterator iter) noexcept
+		{
+			KTL_ASSERT(iter >= m_Begin && iter < m_End);
+
+			std::memmove(const_cast<iterator>(iter), iter + 1, ((m_End - iter) - 1) * sizeof(T));
+
+			m_End--;
+
+			return const_cast<iterator>(iter);
+		}
+
+		/**
+		 * @brief Erases all elements in a range.
+		 * @param first An iterator pointing to the first element.
+		 * @param last An iterator pointing to the location after the last element.
+		 * @return An iterator pointing to the element immidiately after the erased ones.
+		*/
+		iterator erase(const_iterator first, const_iterator last) noexcept
+		{
+			KTL_ASSERT(first <= last);
+			KTL_ASSERT(first >= m_Begin && last <= m_End);
+
+			std::memmove(const_cast<iterator>(first), last, (m_End - last) * sizeof(T));
+
+			m_End -= (last - first);
+
+			return const_cast<iterator>(first);
+		}
+
+		/**
+		 * @brief Removes the last element from the vector and returns it.
+		 * @return The last element in the vector.
+		*/
+		T pop_back() noexcept { return *--m_End; }
+
+		/**
+		 * @brief Clears all elements in the vector.
+		*/
+		void clear() noexcept { m_End = m_Begin; }
+
+	private:
+		T* inline_data() noexcept
+		{
+			return reinterpret_cast<T*>(m_Inline);
+		}
+
+		const T* inline_data() const noexcept
+		{
+			return reinterpret_cast<const T*>(m_Inline);
+		}
+
+		void expand(size_t n) noexcept
+		{
+			size_t curCap = capacity();
+			size_t alSize = curCap + (std::max)(curCap / 2, n);
+
+			set_size(alSize);
+		}
+
+		void set_size(size_t n) noexcept
+		{
+			size_t curSize = (std::min)(size(), n);
+
+			// Move back into the inline storage if the elements fit
+			if (n <= N)
+			{
+				if (!is_inline())
+				{
+					std::memcpy(inline_data(), m_Begin, curSize * sizeof(T));
+
+					Traits::deallocate(m_Alloc, m_Begin, capacity());
+				}
+
+				m_Begin = inline_data();
+				m_End = m_Begin + curSize;
+				m_EndMax = m_Begin + N;
+				return;
+			}
+
+			// Try to grow the block in place, avoiding the copy
+			if constexpr (detail::has_expand_v<Alloc, T*>)
+			{
+				if (!is_inline() && n > capacity() && m_Alloc.expand(m_Begin, capacity(), n))
+				{
+					m_EndMax = m_Begin + n;
+					return;
+				}
+			}
+
+			T* alBlock = Traits::allocate(m_Alloc, n);
+
+			std::memcpy(alBlock, m_Begin, curSize * sizeof(T));
+
+			if (!is_inline())
+				Traits::deallocate(m_Alloc, m_Begin, capacity());
+
+			m_Begin = alBlock;
+			m_End = m_Begin + curSize;
+			m_EndMax = m_Begin + n;
+		}
+
+		void steal(small_vector& other) noexcept
+		{
+			if (other.is_inline())
+			{
+				// The inline elements have to be copied
+				size_t n = other.size();
+
+				std::memcpy(inline_data(), other.m_Begin, n * sizeof(T));
+
+				m_Begin = inline_data();
+				m_End = m_Begin + n;
+				m_EndMax = m_Begin + N;
+			}
+			else
+			{
+				m_Begin = other.m_Begin;
+				m_End = other.m_End;
+				m_EndMax = other.m_EndMax;
+			}
+
+			other.m_Begin = other.inline_data();
+			other.m_End = other.m_Begin;
+			other.m_EndMax = other.m_Begin + N;
+		}
+
+		void release() noexcept
+		{
+			if (!is_inline())
+				Traits::deallocate(m_Alloc, m_Begin, capacity());
+
+			m_Begin = inline_data();
+			m_End = m_Begin;
+			m_EndMax = m_Begin + N;
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+		T* m_Begin;
+		T* m_End;
+		T* m_EndMax;
+		alignas(T) unsigned char m_Inline[sizeof(T) * N];
+	};
+}
\ No newline at end of file
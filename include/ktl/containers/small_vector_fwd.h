@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace ktl
+{
+	template<typename T, size_t N, typename Alloc = std::allocator<T>>
+	class small_vector;
+}
\ No newline at end of file
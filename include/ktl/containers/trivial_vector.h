@@ -2,6 +2,7 @@
 
 #include "../utility/assert.h"
 #include "../utility/empty_base.h"
+#include "../utility/meta.h"
 #include "trivial_vector_fwd.h"
 
 #include <cstring>
@@ -24,6 +25,7 @@ namespace ktl
 		static_assert(std::is_trivially_copyable<T>::value, "Template class needs to be trivially copyable");
 
 		typedef std::allocator_traits<Alloc> Traits;
+		typedef typename Traits::pointer pointer;
 
 	public:
 		typedef T* iterator;
@@ -229,13 +231,13 @@ namespace ktl
 
 		const_iterator end() const noexcept { return m_End; }
 
-		reverse_iterator rbegin() noexcept { return std::reverse_iterator(m_End); }
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
 
-		const_reverse_iterator rbegin() const noexcept { return std::reverse_iterator(m_End); }
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
 
-		reverse_iterator rend() noexcept { return std::reverse_iterator(m_Begin); }
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
 
-		const_reverse_iterator rend() const noexcept { return std::reverse_iterator(m_Begin); }
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
 
 
 		/**
@@ -424,7 +426,7 @@ namespace ktl
 		 * @brief Removes the last element from the vector and returns it.
 		 * @return The last element in the vector.
 		*/
-		T pop_back() noexcept { return m_Begin[--m_End]; }
+		T pop_back() noexcept { return *--m_End; }
 
 		/**
 		 * @brief Clears all elements in the vector.
@@ -444,6 +446,16 @@ namespace ktl
 		{
 			size_t curSize = (std::min)(size(), n);
 
+			// Try to grow the block in place, avoiding the copy
+			if constexpr (detail::has_expand_v<Alloc, T*>)
+			{
+				if (m_Begin != nullptr && n > capacity() && m_Alloc.expand(m_Begin, capacity(), n))
+				{
+					m_EndMax = m_Begin + n;
+					return;
+				}
+			}
+
 			T* alBlock = Traits::allocate(m_Alloc, n);
 
 			if (m_Begin != nullptr)
@@ -460,10 +472,8 @@ namespace ktl
 
 	private:
 		KTL_EMPTY_BASE Alloc m_Alloc;
-		T* m_Begin;
-		T* m_End;
-		T* m_EndMax;
-		
-		//std::conditional_t<sizeof(T) < 32, uint8_t[32], uint8_t*> m_Data;
+		pointer m_Begin;
+		pointer m_End;
+		pointer m_EndMax;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,730 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/hash_group.h"
+#include "../utility/relocatable.h"
+#include "unordered_map_fwd.h"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief An open-addressing hash map, which stores its key-value pairs in a single flat array of slots.
+	 * Each slot has a control byte, containing 7 bits of its hash, which are probed 16 at a time using SSE2, if available.
+	 * Only slots whose control byte matches are compared with the key, so most lookups only touch a single cache line of the values.
+	 * @note Inserting can rehash the map, which invalidates all iterators and references.
+	 * Erasing does not move any elements, so only iterators to the erased element are invalidated
+	 * @tparam K The type of the key. Must be copy constructible
+	 * @tparam V The type of the value
+	 * @tparam Hash The hash function to use for the keys
+	 * @tparam Equal The function to use for comparing keys
+	 * @tparam Alloc The type of allocator to use
+	*/
+	template<typename K, typename V, typename Hash, typename Equal, typename Alloc>
+	class unordered_map
+	{
+	public:
+		typedef K key_type;
+		typedef V mapped_type;
+		typedef std::pair<const K, V> value_type;
+
+	private:
+		typedef detail::ctrl_t ctrl_t;
+		typedef detail::hash_group group;
+
+		typedef std::allocator_traits<Alloc> Traits;
+
+		static_assert(std::is_same_v<typename Traits::value_type, value_type>, "The allocator must allocate key-value pairs");
+
+		// The amount of control bytes which are mirrored at the end, so a group can be loaded from any slot
+		static constexpr size_t CLONED = group::WIDTH - 1;
+
+		template<bool Const>
+		class iterator_base
+		{
+		private:
+			typedef std::conditional_t<Const, const std::pair<const K, V>, std::pair<const K, V>> element_type;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef std::ptrdiff_t difference_type;
+			typedef element_type value_type;
+			typedef element_type* pointer;
+			typedef element_type& reference;
+
+			iterator_base() noexcept :
+				m_Ctrl(nullptr),
+				m_Slot(nullptr) {}
+
+			iterator_base(const ctrl_t* ctrl, element_type* slot) noexcept :
+				m_Ctrl(ctrl),
+				m_Slot(slot) {}
+
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			iterator_base(const iterator_base<false>& other) noexcept :
+				m_Ctrl(other.m_Ctrl),
+				m_Slot(other.m_Slot) {}
+
+			reference operator*() const noexcept { return *m_Slot; }
+
+			pointer operator->() const noexcept { return m_Slot; }
+
+			iterator_base& operator++() noexcept
+			{
+				++m_Ctrl;
+				++m_Slot;
+				skip_empty_or_deleted();
+				return *this;
+			}
+
+			iterator_base operator++(int) noexcept
+			{
+				iterator_base iter = *this;
+				++(*this);
+				return iter;
+			}
+
+			bool operator==(const iterator_base& rhs) const noexcept { return m_Slot == rhs.m_Slot; }
+
+			bool operator!=(const iterator_base& rhs) const noexcept { return m_Slot != rhs.m_Slot; }
+
+		private:
+			friend class unordered_map;
+			friend class iterator_base<!Const>;
+
+			void skip_empty_or_deleted() noexcept
+			{
+				// The sentinel stops the iteration at the end
+				while (*m_Ctrl < detail::CTRL_SENTINEL)
+				{
+					uint32_t shift = group(m_Ctrl).count_leading_empty_or_deleted();
+					m_Ctrl += shift;
+					m_Slot += shift;
+				}
+			}
+
+			const ctrl_t* m_Ctrl;
+			element_type* m_Slot;
+		};
+
+	public:
+		typedef iterator_base<false> iterator;
+		typedef iterator_base<true> const_iterator;
+
+	public:
+		/**
+		 * @brief Construct the map with a default constructed allocator
+		*/
+		unordered_map() noexcept :
+			m_Hash(),
+			m_Equal(),
+			m_Alloc(),
+			m_Ctrl(nullptr),
+			m_Slots(nullptr),
+			m_Size(0),
+			m_Capacity(0),
+			m_GrowthLeft(0) {}
+
+		/**
+		 * @brief Construct the map with the given allocator
+		 * @param allocator The allocator to use
+		*/
+		explicit unordered_map(const Alloc& allocator) noexcept :
+			m_Hash(),
+			m_Equal(),
+			m_Alloc(allocator),
+			m_Ctrl(nullptr),
+			m_Slots(nullptr),
+			m_Size(0),
+			m_Capacity(0),
+			m_GrowthLeft(0) {}
+
+		/**
+		 * @brief Construct the map with the given hash and compare functions and allocator
+		 * @param hash The hash function to use
+		 * @param equal The function to use for comparing keys
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		unordered_map(const Hash& hash, const Equal& equal, const Alloc& allocator = Alloc()) noexcept :
+			m_Hash(hash),
+			m_Equal(equal),
+			m_Alloc(allocator),
+			m_Ctrl(nullptr),
+			m_Slots(nullptr),
+			m_Size(0),
+			m_Capacity(0),
+			m_GrowthLeft(0) {}
+
+		unordered_map(const unordered_map& other) :
+			m_Hash(other.m_Hash),
+			m_Equal(other.m_Equal),
+			m_Alloc(Traits::select_on_container_copy_construction(static_cast<Alloc>(other.m_Alloc))),
+			m_Ctrl(nullptr),
+			m_Slots(nullptr),
+			m_Size(0),
+			m_Capacity(0),
+			m_GrowthLeft(0)
+		{
+			copy_from(other);
+		}
+
+		unordered_map(unordered_map&& other) noexcept :
+			m_Hash(std::move(other.m_Hash)),
+			m_Equal(std::move(other.m_Equal)),
+			m_Alloc(std::move(other.m_Alloc)),
+			m_Ctrl(other.m_Ctrl),
+			m_Slots(other.m_Slots),
+			m_Size(other.m_Size),
+			m_Capacity(other.m_Capacity),
+			m_GrowthLeft(other.m_GrowthLeft)
+		{
+			other.reset();
+		}
+
+		~unordered_map() noexcept
+		{
+			release();
+		}
+
+		unordered_map& operator=(const unordered_map& other)
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Hash = other.m_Hash;
+			m_Equal = other.m_Equal;
+			m_Alloc = other.m_Alloc;
+
+			copy_from(other);
+
+			return *this;
+		}
+
+		unordered_map& operator=(unordered_map&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Hash = std::move(other.m_Hash);
+			m_Equal = std::move(other.m_Equal);
+			m_Alloc = std::move(other.m_Alloc);
+			m_Ctrl = other.m_Ctrl;
+			m_Slots = other.m_Slots;
+			m_Size = other.m_Size;
+			m_Capacity = other.m_Capacity;
+			m_GrowthLeft = other.m_GrowthLeft;
+
+			other.reset();
+
+			return *this;
+		}
+
+		/**
+		 * @brief Returns a reference to the value with the given key, inserting a value-initialized one if it doesn't exist
+		 * @param key The key of the value
+		 * @return A reference to the value
+		*/
+		V& operator[](const K& key)
+		{
+			return emplace(key).first->second;
+		}
+
+		/**
+		 * @brief Returns a reference to the value with the given key, inserting a value-initialized one if it doesn't exist
+		 * @param key The key of the value
+		 * @return A reference to the value
+		*/
+		V& operator[](K&& key)
+		{
+			return emplace(std::move(key)).first->second;
+		}
+
+
+		iterator begin() noexcept
+		{
+			if (m_Capacity == 0)
+				return end();
+
+			iterator iter(m_Ctrl, m_Slots);
+			iter.skip_empty_or_deleted();
+			return iter;
+		}
+
+		const_iterator begin() const noexcept
+		{
+			if (m_Capacity == 0)
+				return end();
+
+			const_iterator iter(m_Ctrl, m_Slots);
+			iter.skip_empty_or_deleted();
+			return iter;
+		}
+
+		iterator end() noexcept { return iterator(m_Ctrl + m_Capacity, m_Slots + m_Capacity); }
+
+		const_iterator end() const noexcept { return const_iterator(m_Ctrl + m_Capacity, m_Slots + m_Capacity); }
+
+
+		/**
+		 * @brief Returns the amount of key-value pairs in the map
+		 * @return The amount of key-value pairs in the map
+		*/
+		size_t size() const noexcept { return m_Size; }
+
+		/**
+		 * @brief Returns the amount of slots in the map. Some of these are always kept empty to keep probing short
+		 * @return The amount of slots in the map
+		*/
+		size_t capacity() const noexcept { return m_Capacity; }
+
+		/**
+		 * @brief Returns true if the map has no key-value pairs
+		 * @return Whether the map is empty
+		*/
+		bool empty() const noexcept { return m_Size == 0; }
+
+		/**
+		 * @brief Returns the function used to hash keys
+		 * @return A copy of the hash function
+		*/
+		Hash hash_function() const { return m_Hash; }
+
+		/**
+		 * @brief Returns the function used to compare keys
+		 * @return A copy of the compare function
+		*/
+		Equal key_eq() const { return m_Equal; }
+
+
+		/**
+		 * @brief Finds the key-value pair with the given key
+		 * @param key The key to look for
+		 * @return An iterator to the key-value pair, or end() if it doesn't exist
+		*/
+		iterator find(const K& key)
+		{
+			size_t index = find_index(key);
+			if (index == m_Capacity)
+				return end();
+
+			return iterator(m_Ctrl + index, m_Slots + index);
+		}
+
+		/**
+		 * @brief Finds the key-value pair with the given key
+		 * @param key The key to look for
+		 * @return An iterator to the key-value pair, or end() if it doesn't exist
+		*/
+		const_iterator find(const K& key) const
+		{
+			size_t index = find_index(key);
+			if (index == m_Capacity)
+				return end();
+
+			return const_iterator(m_Ctrl + index, m_Slots + index);
+		}
+
+		/**
+		 * @brief Returns whether a key-value pair with the given key exists
+		 * @param key The key to look for
+		 * @return Whether the key exists in the map
+		*/
+		bool contains(const K& key) const
+		{
+			return find_index(key) != m_Capacity;
+		}
+
+		/**
+		 * @brief Inserts a key-value pair, if the key doesn't already exist
+		 * @param key The key to insert
+		 * @param value The value to insert
+		 * @return An iterator to the key-value pair with the key and whether it was inserted
+		*/
+		template<typename Key, typename Value>
+		std::pair<iterator, bool> insert(Key&& key, Value&& value)
+		{
+			return emplace(std::forward<Key>(key), std::forward<Value>(value));
+		}
+
+		/**
+		 * @brief Inserts a key-value pair by copying it, if the key doesn't already exist
+		 * @param pair The key-value pair to insert
+		 * @return An iterator to the key-value pair with the key and whether it was inserted
+		*/
+		std::pair<iterator, bool> insert(const value_type& pair)
+		{
+			return emplace(pair.first, pair.second);
+		}
+
+		/**
+		 * @brief Inserts a key-value pair by moving it, if the key doesn't already exist
+		 * @param pair The key-value pair to insert
+		 * @return An iterator to the key-value pair with the key and whether it was inserted
+		*/
+		std::pair<iterator, bool> insert(value_type&& pair)
+		{
+			return emplace(pair.first, std::move(pair.second));
+		}
+
+		/**
+		 * @brief Constructs a key-value pair in the map, if the key doesn't already exist.
+		 * The value is not constructed if the key already exists.
+		 * @param key The key to insert
+		 * @param ...args The arguments to construct the value with
+		 * @return An iterator to the key-value pair with the key and whether it was inserted
+		*/
+		template<typename Key, typename... Args>
+		std::pair<iterator, bool> emplace(Key&& key, Args&&... args)
+		{
+			size_t hash = hash_key(key);
+
+			size_t index = find_index(key, hash);
+			if (index != m_Capacity)
+				return { iterator(m_Ctrl + index, m_Slots + index), false };
+
+			index = prepare_insert(hash);
+
+			Traits::construct(m_Alloc, m_Slots + index,
+				std::piecewise_construct,
+				std::forward_as_tuple(std::forward<Key>(key)),
+				std::forward_as_tuple(std::forward<Args>(args)...));
+
+			// Only mark the slot as full once the construction succeeded
+			if (m_Ctrl[index] == detail::CTRL_EMPTY)
+				m_GrowthLeft--;
+
+			set_ctrl(index, detail::hash_h2(hash));
+			m_Size++;
+
+			return { iterator(m_Ctrl + index, m_Slots + index), true };
+		}
+
+		/**
+		 * @brief Erases the key-value pair pointed to by the iterator
+		 * @param iter An iterator pointing to the key-value pair
+		 * @return An iterator to the next key-value pair
+		*/
+		iterator erase(const_iterator iter) noexcept
+		{
+			KTL_ASSERT(iter != end());
+
+			size_t index = size_t(iter.m_Slot - m_Slots);
+
+			erase_index(index);
+
+			iterator next(m_Ctrl + index, m_Slots + index);
+			++next;
+
+			return next;
+		}
+
+		/**
+		 * @brief Erases the key-value pair with the given key, if it exists
+		 * @param key The key to erase
+		 * @return The amount of key-value pairs that were erased
+		*/
+		size_t erase(const K& key)
+		{
+			size_t index = find_index(key);
+			if (index == m_Capacity)
+				return 0;
+
+			erase_index(index);
+
+			return 1;
+		}
+
+		/**
+		 * @brief Erases all key-value pairs in the map, without deallocating the memory
+		*/
+		void clear() noexcept
+		{
+			if (m_Capacity == 0)
+				return;
+
+			destroy_slots();
+
+			reset_ctrl();
+
+			m_Size = 0;
+			m_GrowthLeft = capacity_to_growth(m_Capacity);
+		}
+
+		/**
+		 * @brief Reserves enough slots for @p n key-value pairs to be inserted without rehashing
+		 * @param n The amount of key-value pairs to reserve space for
+		*/
+		void reserve(size_t n)
+		{
+			if (n <= m_Size + m_GrowthLeft)
+				return;
+
+			size_t cap = CLONED;
+			while (capacity_to_growth(cap) < n)
+				cap = cap * 2 + 1;
+
+			resize(cap);
+		}
+
+	private:
+		// The amount of key-value pairs which can be stored in a capacity, while keeping 1/8th of the slots empty
+		static constexpr size_t capacity_to_growth(size_t cap) noexcept
+		{
+			return cap - cap / 8;
+		}
+
+		// The slots and control bytes are stored in a single allocation, with the control bytes at the end
+		static constexpr size_t allocation_size(size_t cap) noexcept
+		{
+			return cap + (cap + group::WIDTH + sizeof(value_type) - 1) / sizeof(value_type);
+		}
+
+		void allocate(size_t cap)
+		{
+			m_Slots = Traits::allocate(m_Alloc, allocation_size(cap));
+			m_Ctrl = reinterpret_cast<ctrl_t*>(m_Slots + cap);
+			m_Capacity = cap;
+		}
+
+		size_t hash_key(const K& key) const
+		{
+			return detail::mix_hash(m_Hash(key));
+		}
+
+		size_t find_index(const K& key) const
+		{
+			if (m_Capacity == 0)
+				return 0;
+
+			return find_index(key, hash_key(key));
+		}
+
+		size_t find_index(const K& key, size_t hash) const
+		{
+			if (m_Capacity == 0)
+				return 0;
+
+			ctrl_t h2 = detail::hash_h2(hash);
+			size_t pos = detail::hash_h1(hash) & m_Capacity;
+			size_t step = 0;
+
+			while (true)
+			{
+				group g(m_Ctrl + pos);
+
+				for (uint32_t i : g.match(h2))
+				{
+					size_t index = (pos + i) & m_Capacity;
+					if (m_Equal(m_Slots[index].first, key))
+						return index;
+				}
+
+				// The key would have been inserted in the first empty slot
+				if (g.match_empty())
+					return m_Capacity;
+
+				// Triangular probing visits every group, since the capacity is a power of 2 minus 1
+				step += group::WIDTH;
+				pos = (pos + step) & m_Capacity;
+			}
+		}
+
+		size_t find_first_non_full(size_t hash) const noexcept
+		{
+			size_t pos = detail::hash_h1(hash) & m_Capacity;
+			size_t step = 0;
+
+			while (true)
+			{
+				group g(m_Ctrl + pos);
+
+				if (auto mask = g.match_empty_or_deleted())
+					return (pos + mask.trailing_zeros()) & m_Capacity;
+
+				step += group::WIDTH;
+				pos = (pos + step) & m_Capacity;
+			}
+		}
+
+		size_t prepare_insert(size_t hash)
+		{
+			size_t index = m_Capacity > 0 ? find_first_non_full(hash) : 0;
+
+			// Reusing a deleted slot doesn't reduce the amount of empty slots
+			if (m_GrowthLeft == 0 && (m_Capacity == 0 || m_Ctrl[index] != detail::CTRL_DELETED))
+			{
+				rehash_and_grow();
+				index = find_first_non_full(hash);
+			}
+
+			return index;
+		}
+
+		void rehash_and_grow()
+		{
+			if (m_Capacity == 0)
+				resize(CLONED);
+			else if (m_Size * 32 <= capacity_to_growth(m_Capacity) * 25)
+				resize(m_Capacity); // Mostly deleted slots, so just clean them up
+			else
+				resize(m_Capacity * 2 + 1);
+		}
+
+		void set_ctrl(size_t index, ctrl_t value) noexcept
+		{
+			m_Ctrl[index] = value;
+			m_Ctrl[((index - CLONED) & m_Capacity) + CLONED] = value;
+		}
+
+		void reset_ctrl() noexcept
+		{
+			std::memset(m_Ctrl, detail::CTRL_EMPTY, m_Capacity + group::WIDTH);
+			m_Ctrl[m_Capacity] = detail::CTRL_SENTINEL;
+		}
+
+		void erase_index(size_t index) noexcept
+		{
+			Traits::destroy(m_Alloc, m_Slots + index);
+
+			m_Size--;
+
+			// If no probe sequence could have passed this slot while it was full, it can be marked as empty again
+			size_t indexBefore = (index - group::WIDTH) & m_Capacity;
+			auto emptyAfter = group(m_Ctrl + index).match_empty();
+			auto emptyBefore = group(m_Ctrl + indexBefore).match_empty();
+
+			bool wasNeverFull = emptyBefore && emptyAfter &&
+				(emptyAfter.trailing_zeros() + emptyBefore.leading_zeros()) < group::WIDTH;
+
+			if (wasNeverFull)
+			{
+				set_ctrl(index, detail::CTRL_EMPTY);
+				m_GrowthLeft++;
+			}
+			else
+			{
+				set_ctrl(index, detail::CTRL_DELETED);
+			}
+		}
+
+		void resize(size_t newCapacity)
+		{
+			ctrl_t* oldCtrl = m_Ctrl;
+			value_type* oldSlots = m_Slots;
+			size_t oldCapacity = m_Capacity;
+
+			allocate(newCapacity);
+			m_GrowthLeft = capacity_to_growth(newCapacity) - m_Size;
+
+			reset_ctrl();
+
+			if (!oldCtrl)
+				return;
+
+			for (size_t i = 0; i < oldCapacity; i++)
+			{
+				if (!detail::is_full(oldCtrl[i]))
+					continue;
+
+				size_t hash = hash_key(oldSlots[i].first);
+				size_t index = find_first_non_full(hash);
+
+				set_ctrl(index, detail::hash_h2(hash));
+
+				if constexpr (is_trivially_relocatable_v<value_type>)
+				{
+					std::memcpy(static_cast<void*>(m_Slots + index), static_cast<const void*>(oldSlots + i), sizeof(value_type));
+				}
+				else
+				{
+					// The key is const, so it has to be copied
+					Traits::construct(m_Alloc, m_Slots + index, std::move(oldSlots[i]));
+					Traits::destroy(m_Alloc, oldSlots + i);
+				}
+			}
+
+			Traits::deallocate(m_Alloc, oldSlots, allocation_size(oldCapacity));
+		}
+
+		void copy_from(const unordered_map& other)
+		{
+			if (other.m_Capacity == 0)
+				return;
+
+			allocate(other.m_Capacity);
+
+			reset_ctrl();
+
+			// Keep the same layout, so nothing has to be rehashed
+			for (size_t i = 0; i < m_Capacity; i++)
+			{
+				if (!detail::is_full(other.m_Ctrl[i]))
+					continue;
+
+				Traits::construct(m_Alloc, m_Slots + i, other.m_Slots[i]);
+
+				set_ctrl(i, other.m_Ctrl[i]);
+				m_Size++;
+			}
+
+			// Deleted slots are now empty
+			m_GrowthLeft = capacity_to_growth(m_Capacity) - m_Size;
+		}
+
+		void destroy_slots() noexcept
+		{
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+
+				for (size_t i = 0; i < m_Capacity; i++)
+				{
+					if (detail::is_full(m_Ctrl[i]))
+						Traits::destroy(m_Alloc, m_Slots + i);
+				}
+			}
+		}
+
+		void release() noexcept
+		{
+			if (m_Capacity == 0)
+				return;
+
+			destroy_slots();
+
+			Traits::deallocate(m_Alloc, m_Slots, allocation_size(m_Capacity));
+
+			reset();
+		}
+
+		void reset() noexcept
+		{
+			m_Ctrl = nullptr;
+			m_Slots = nullptr;
+			m_Size = 0;
+			m_Capacity = 0;
+			m_GrowthLeft = 0;
+		}
+
+	private:
+		KTL_EMPTY_BASE Hash m_Hash;
+		KTL_EMPTY_BASE Equal m_Equal;
+		KTL_EMPTY_BASE Alloc m_Alloc;
+		ctrl_t* m_Ctrl;
+		value_type* m_Slots;
+		size_t m_Size;
+		size_t m_Capacity;
+		size_t m_GrowthLeft;
+	};
+}
\ No newline at end of file
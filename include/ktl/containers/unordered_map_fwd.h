@@ -0,0 +1,11 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace ktl
+{
+	template<typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>, typename Alloc = std::allocator<std::pair<const K, V>>>
+	class unordered_map;
+}
\ No newline at end of file
@@ -0,0 +1,671 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/relocatable.h"
+#include "unordered_map.h"
+#include "unordered_multimap_fwd.h"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief A hash map which allows multiple values with the same key.
+	 * Values with the same key are stored contiguously in a group, which is found through an open-addressing ktl::unordered_map.
+	 * Looking up all values with a given key is therefore a single hash lookup, followed by a linear scan over adjacent memory.
+	 * @note Erasing a value moves the last value in its group into its place, so the order of values with the same key is not kept.
+	 * Inserting can rehash the map or reallocate the group, which invalidates iterators and references
+	 * @tparam K The type of the key. Must be copy constructible
+	 * @tparam V The type of the value
+	 * @tparam Hash The hash function to use for the keys
+	 * @tparam Equal The function to use for comparing keys
+	 * @tparam Alloc The type of allocator to use. Must be able to be rebound to other types
+	*/
+	template<typename K, typename V, typename Hash, typename Equal, typename Alloc>
+	class unordered_multimap
+	{
+	public:
+		typedef K key_type;
+		typedef V mapped_type;
+		typedef std::pair<const K, V> value_type;
+
+	private:
+		typedef std::allocator_traits<Alloc> Traits;
+
+		static_assert(std::is_same_v<typename Traits::value_type, value_type>, "The allocator must allocate key-value pairs");
+
+		// A contiguous array of key-value pairs with the same key
+		struct group
+		{
+			value_type* Data;
+			size_t Size;
+			size_t Capacity;
+		};
+
+		typedef typename Traits::template rebind_alloc<std::pair<const K, group>> IndexAlloc;
+		typedef ktl::unordered_map<K, group, Hash, Equal, IndexAlloc> index_type;
+		typedef typename index_type::iterator index_iterator;
+		typedef typename index_type::const_iterator index_const_iterator;
+
+		template<bool Const, typename I>
+		class iterator_base
+		{
+		private:
+			typedef std::conditional_t<Const, const std::pair<const K, V>, std::pair<const K, V>> element_type;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef std::ptrdiff_t difference_type;
+			typedef element_type value_type;
+			typedef element_type* pointer;
+			typedef element_type& reference;
+
+			iterator_base() noexcept :
+				m_Group(),
+				m_Index(0) {}
+
+			iterator_base(I group, size_t index) noexcept :
+				m_Group(group),
+				m_Index(index) {}
+
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			iterator_base(const iterator_base<false, index_iterator>& other) noexcept :
+				m_Group(other.m_Group),
+				m_Index(other.m_Index) {}
+
+			reference operator*() const noexcept { return m_Group->second.Data[m_Index]; }
+
+			pointer operator->() const noexcept { return m_Group->second.Data + m_Index; }
+
+			iterator_base& operator++() noexcept
+			{
+				// Groups are never empty, so the next group always has a first element
+				if (++m_Index == m_Group->second.Size)
+				{
+					++m_Group;
+					m_Index = 0;
+				}
+
+				return *this;
+			}
+
+			iterator_base operator++(int) noexcept
+			{
+				iterator_base iter = *this;
+				++(*this);
+				return iter;
+			}
+
+			bool operator==(const iterator_base& rhs) const noexcept { return m_Group == rhs.m_Group && m_Index == rhs.m_Index; }
+
+			bool operator!=(const iterator_base& rhs) const noexcept { return m_Group != rhs.m_Group || m_Index != rhs.m_Index; }
+
+		private:
+			friend class unordered_multimap;
+			friend class iterator_base<!Const, index_const_iterator>;
+
+			I m_Group;
+			size_t m_Index;
+		};
+
+		template<bool Const>
+		class key_iterator_base
+		{
+		private:
+			typedef std::conditional_t<Const, const std::pair<const K, V>, std::pair<const K, V>> element_type;
+
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef std::ptrdiff_t difference_type;
+			typedef element_type value_type;
+			typedef element_type* pointer;
+			typedef element_type& reference;
+
+			key_iterator_base() noexcept :
+				m_Current(nullptr),
+				m_End(nullptr) {}
+
+			key_iterator_base(element_type* current, element_type* end) noexcept :
+				m_Current(current),
+				m_End(end) {}
+
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			key_iterator_base(const key_iterator_base<false>& other) noexcept :
+				m_Current(other.m_Current),
+				m_End(other.m_End) {}
+
+			/**
+			 * @brief Returns whether the iterator points to a value, rather than past the last value with the key
+			*/
+			explicit operator bool() const noexcept { return m_Current != m_End; }
+
+			reference operator*() const noexcept { return *m_Current; }
+
+			pointer operator->() const noexcept { return m_Current; }
+
+			key_iterator_base& operator++() noexcept
+			{
+				++m_Current;
+				return *this;
+			}
+
+			key_iterator_base operator++(int) noexcept
+			{
+				key_iterator_base iter = *this;
+				++m_Current;
+				return iter;
+			}
+
+			bool operator==(const key_iterator_base& rhs) const noexcept { return m_Current == rhs.m_Current; }
+
+			bool operator!=(const key_iterator_base& rhs) const noexcept { return m_Current != rhs.m_Current; }
+
+		private:
+			friend class unordered_multimap;
+			friend class key_iterator_base<!Const>;
+
+			element_type* m_Current;
+			element_type* m_End;
+		};
+
+	public:
+		typedef iterator_base<false, index_iterator> iterator;
+		typedef iterator_base<true, index_const_iterator> const_iterator;
+
+		/**
+		 * @brief An iterator over the values with the same key, which converts to false once it has passed the last one
+		*/
+		typedef key_iterator_base<false> key_iterator;
+		typedef key_iterator_base<true> const_key_iterator;
+
+	public:
+		/**
+		 * @brief Construct the map with a default constructed allocator
+		*/
+		unordered_multimap() noexcept :
+			m_Alloc(),
+			m_Index(IndexAlloc(m_Alloc)),
+			m_Size(0),
+			m_Capacity(0) {}
+
+		/**
+		 * @brief Construct the map with the given allocator
+		 * @param allocator The allocator to use
+		*/
+		explicit unordered_multimap(const Alloc& allocator) noexcept :
+			m_Alloc(allocator),
+			m_Index(IndexAlloc(m_Alloc)),
+			m_Size(0),
+			m_Capacity(0) {}
+
+		/**
+		 * @brief Construct the map with the given hash and compare functions and allocator
+		 * @param hash The hash function to use
+		 * @param equal The function to use for comparing keys
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		unordered_multimap(const Hash& hash, const Equal& equal, const Alloc& allocator = Alloc()) noexcept :
+			m_Alloc(allocator),
+			m_Index(hash, equal, IndexAlloc(m_Alloc)),
+			m_Size(0),
+			m_Capacity(0) {}
+
+		unordered_multimap(const unordered_multimap& other) :
+			m_Alloc(Traits::select_on_container_copy_construction(static_cast<Alloc>(other.m_Alloc))),
+			m_Index(other.hash_function(), other.key_eq(), IndexAlloc(m_Alloc)),
+			m_Size(0),
+			m_Capacity(0)
+		{
+			copy_from(other);
+		}
+
+		unordered_multimap(unordered_multimap&& other) noexcept :
+			m_Alloc(std::move(other.m_Alloc)),
+			m_Index(std::move(other.m_Index)),
+			m_Size(other.m_Size),
+			m_Capacity(other.m_Capacity)
+		{
+			other.m_Size = 0;
+			other.m_Capacity = 0;
+		}
+
+		~unordered_multimap() noexcept
+		{
+			clear();
+		}
+
+		unordered_multimap& operator=(const unordered_multimap& other)
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+
+			m_Alloc = other.m_Alloc;
+			m_Index = index_type(other.hash_function(), other.key_eq(), IndexAlloc(m_Alloc));
+
+			copy_from(other);
+
+			return *this;
+		}
+
+		unordered_multimap& operator=(unordered_multimap&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+
+			m_Alloc = std::move(other.m_Alloc);
+			m_Index = std::move(other.m_Index);
+			m_Size = other.m_Size;
+			m_Capacity = other.m_Capacity;
+
+			other.m_Size = 0;
+			other.m_Capacity = 0;
+
+			return *this;
+		}
+
+
+		iterator begin() noexcept { return iterator(m_Index.begin(), 0); }
+
+		const_iterator begin() const noexcept { return const_iterator(m_Index.begin(), 0); }
+
+		iterator end() noexcept { return iterator(m_Index.end(), 0); }
+
+		const_iterator end() const noexcept { return const_iterator(m_Index.end(), 0); }
+
+
+		/**
+		 * @brief Returns the amount of key-value pairs in the map
+		 * @return The amount of key-value pairs in the map
+		*/
+		size_t size() const noexcept { return m_Size; }
+
+		/**
+		 * @brief Returns the amount of key-value pairs which fit in the currently allocated groups
+		 * @return The amount of key-value pairs which fit in the map without allocating
+		*/
+		size_t capacity() const noexcept { return m_Capacity; }
+
+		/**
+		 * @brief Returns true if the map has no key-value pairs
+		 * @return Whether the map is empty
+		*/
+		bool empty() const noexcept { return m_Size == 0; }
+
+		/**
+		 * @brief Returns the function used to hash keys
+		 * @return A copy of the hash function
+		*/
+		Hash hash_function() const { return m_Index.hash_function(); }
+
+		/**
+		 * @brief Returns the function used to compare keys
+		 * @return A copy of the compare function
+		*/
+		Equal key_eq() const { return m_Index.key_eq(); }
+
+
+		/**
+		 * @brief Finds the key-value pairs with the given key
+		 * @param key The key to look for
+		 * @return An iterator over every key-value pair with the key, which converts to false if there are none
+		*/
+		key_iterator find(const K& key)
+		{
+			auto iter = m_Index.find(key);
+			if (iter == m_Index.end())
+				return key_iterator();
+
+			group& values = iter->second;
+
+			return key_iterator(values.Data, values.Data + values.Size);
+		}
+
+		/**
+		 * @brief Finds the key-value pairs with the given key
+		 * @param key The key to look for
+		 * @return An iterator over every key-value pair with the key, which converts to false if there are none
+		*/
+		const_key_iterator find(const K& key) const
+		{
+			auto iter = m_Index.find(key);
+			if (iter == m_Index.end())
+				return const_key_iterator();
+
+			const group& values = iter->second;
+
+			return const_key_iterator(values.Data, values.Data + values.Size);
+		}
+
+		/**
+		 * @brief Returns the contiguous range of key-value pairs with the given key
+		 * @param key The key to look for
+		 * @return A pointer to the first key-value pair and a pointer past the last one. Both are nullptr if there are none
+		*/
+		std::pair<value_type*, value_type*> equal_range(const K& key)
+		{
+			auto iter = m_Index.find(key);
+			if (iter == m_Index.end())
+				return { nullptr, nullptr };
+
+			group& values = iter->second;
+
+			return { values.Data, values.Data + values.Size };
+		}
+
+		/**
+		 * @brief Returns the contiguous range of key-value pairs with the given key
+		 * @param key The key to look for
+		 * @return A pointer to the first key-value pair and a pointer past the last one. Both are nullptr if there are none
+		*/
+		std::pair<const value_type*, const value_type*> equal_range(const K& key) const
+		{
+			auto iter = m_Index.find(key);
+			if (iter == m_Index.end())
+				return { nullptr, nullptr };
+
+			const group& values = iter->second;
+
+			return { values.Data, values.Data + values.Size };
+		}
+
+		/**
+		 * @brief Returns the amount of key-value pairs with the given key
+		 * @param key The key to look for
+		 * @return The amount of key-value pairs with the key
+		*/
+		size_t count(const K& key) const
+		{
+			auto iter = m_Index.find(key);
+			if (iter == m_Index.end())
+				return 0;
+
+			return iter->second.Size;
+		}
+
+		/**
+		 * @brief Returns whether any key-value pair with the given key exists
+		 * @param key The key to look for
+		 * @return Whether the key exists in the map
+		*/
+		bool contains(const K& key) const
+		{
+			return m_Index.contains(key);
+		}
+
+		/**
+		 * @brief Inserts a key-value pair into the map
+		 * @param key The key to insert
+		 * @param value The value to insert
+		 * @return An iterator to the inserted key-value pair
+		*/
+		template<typename Key, typename Value>
+		iterator insert(Key&& key, Value&& value)
+		{
+			return emplace(std::forward<Key>(key), std::forward<Value>(value));
+		}
+
+		/**
+		 * @brief Inserts a key-value pair into the map by copying it
+		 * @param pair The key-value pair to insert
+		 * @return An iterator to the inserted key-value pair
+		*/
+		iterator insert(const value_type& pair)
+		{
+			return emplace(pair.first, pair.second);
+		}
+
+		/**
+		 * @brief Constructs a key-value pair in the map, after any existing pairs with the same key
+		 * @param key The key to insert
+		 * @param ...args The arguments to construct the value with
+		 * @return An iterator to the inserted key-value pair
+		*/
+		template<typename Key, typename... Args>
+		iterator emplace(Key&& key, Args&&... args)
+		{
+			auto [groupIter, inserted] = m_Index.emplace(key, group{ nullptr, 0, 0 });
+
+			group& values = groupIter->second;
+
+			try
+			{
+				if (values.Size == values.Capacity)
+					grow(values);
+
+				Traits::construct(m_Alloc, values.Data + values.Size,
+					std::piecewise_construct,
+					std::forward_as_tuple(std::forward<Key>(key)),
+					std::forward_as_tuple(std::forward<Args>(args)...));
+			}
+			catch (...)
+			{
+				// Don't leave an empty group behind
+				if (values.Size == 0)
+				{
+					deallocate(values);
+					m_Index.erase(groupIter);
+				}
+
+				throw;
+			}
+
+			m_Size++;
+
+			return iterator(groupIter, values.Size++);
+		}
+
+		/**
+		 * @brief Erases the key-value pair pointed to by the iterator
+		 * @param iter An iterator pointing to the key-value pair
+		 * @return An iterator to the next key-value pair
+		*/
+		iterator erase(iterator iter) noexcept
+		{
+			KTL_ASSERT(iter != end());
+
+			index_iterator groupIter = iter.m_Group;
+			group& values = groupIter->second;
+
+			erase_value(values, values.Data + iter.m_Index);
+
+			if (values.Size == 0)
+			{
+				deallocate(values);
+
+				return iterator(m_Index.erase(groupIter), 0);
+			}
+
+			// The last value was moved into the erased one's place
+			if (iter.m_Index == values.Size)
+				return iterator(++groupIter, 0);
+
+			return iterator(groupIter, iter.m_Index);
+		}
+
+		/**
+		 * @brief Erases the key-value pair pointed to by the key iterator
+		 * @param iter An iterator returned by find(), pointing to the key-value pair
+		 * @return An iterator to the next key-value pair with the same key
+		*/
+		key_iterator erase(const_key_iterator iter) noexcept
+		{
+			KTL_ASSERT(iter);
+
+			index_iterator groupIter = m_Index.find(iter->first);
+			group& values = groupIter->second;
+
+			value_type* current = values.Data + (iter.m_Current - values.Data);
+
+			erase_value(values, current);
+
+			if (values.Size == 0)
+			{
+				deallocate(values);
+				m_Index.erase(groupIter);
+
+				return key_iterator();
+			}
+
+			return key_iterator(current, values.Data + values.Size);
+		}
+
+		/**
+		 * @brief Erases every key-value pair with the given key
+		 * @param key The key to erase
+		 * @return The amount of key-value pairs that were erased
+		*/
+		size_t erase(const K& key)
+		{
+			auto groupIter = m_Index.find(key);
+			if (groupIter == m_Index.end())
+				return 0;
+
+			group& values = groupIter->second;
+			size_t amount = values.Size;
+
+			destroy(values);
+			deallocate(values);
+
+			m_Index.erase(groupIter);
+
+			return amount;
+		}
+
+		/**
+		 * @brief Erases all key-value pairs in the map
+		*/
+		void clear() noexcept
+		{
+			for (auto& [key, values] : m_Index)
+			{
+				destroy(values);
+				deallocate(values);
+			}
+
+			m_Index.clear();
+		}
+
+		/**
+		 * @brief Reserves enough space for @p n different keys to be inserted without rehashing
+		 * @param n The amount of keys to reserve space for
+		*/
+		void reserve(size_t n)
+		{
+			m_Index.reserve(n);
+		}
+
+	private:
+		void grow(group& values)
+		{
+			size_t newCapacity = values.Capacity > 0 ? values.Capacity * 2 : 1;
+
+			// Try to grow the group in place, avoiding the move
+			if constexpr (detail::has_expand_v<Alloc, value_type*>)
+			{
+				if (values.Data && m_Alloc.expand(values.Data, values.Capacity, newCapacity))
+				{
+					m_Capacity += newCapacity - values.Capacity;
+					values.Capacity = newCapacity;
+					return;
+				}
+			}
+
+			value_type* alBlock = Traits::allocate(m_Alloc, newCapacity);
+
+			if constexpr (is_trivially_relocatable_v<value_type>)
+			{
+				if (values.Size > 0)
+					std::memcpy(static_cast<void*>(alBlock), static_cast<const void*>(values.Data), values.Size * sizeof(value_type));
+			}
+			else
+			{
+				// The key is const, so it has to be copied
+				for (size_t i = 0; i < values.Size; i++)
+				{
+					Traits::construct(m_Alloc, alBlock + i, std::move(values.Data[i]));
+					Traits::destroy(m_Alloc, values.Data + i);
+				}
+			}
+
+			if (values.Data)
+				Traits::deallocate(m_Alloc, values.Data, values.Capacity);
+
+			m_Capacity += newCapacity - values.Capacity;
+
+			values.Data = alBlock;
+			values.Capacity = newCapacity;
+		}
+
+		void erase_value(group& values, value_type* current) noexcept
+		{
+			value_type* last = values.Data + values.Size - 1;
+
+			Traits::destroy(m_Alloc, current);
+
+			if (current != last)
+			{
+				if constexpr (is_trivially_relocatable_v<value_type>)
+				{
+					std::memcpy(static_cast<void*>(current), static_cast<const void*>(last), sizeof(value_type));
+				}
+				else
+				{
+					Traits::construct(m_Alloc, current, std::move(*last));
+					Traits::destroy(m_Alloc, last);
+				}
+			}
+
+			values.Size--;
+			m_Size--;
+		}
+
+		void destroy(group& values) noexcept
+		{
+			for (size_t i = 0; i < values.Size; i++)
+				Traits::destroy(m_Alloc, values.Data + i);
+
+			m_Size -= values.Size;
+			values.Size = 0;
+		}
+
+		void deallocate(group& values) noexcept
+		{
+			if (values.Data)
+				Traits::deallocate(m_Alloc, values.Data, values.Capacity);
+
+			m_Capacity -= values.Capacity;
+
+			values.Data = nullptr;
+			values.Capacity = 0;
+		}
+
+		void copy_from(const unordered_multimap& other)
+		{
+			m_Index.reserve(other.m_Index.size());
+
+			for (auto& [key, values] : other.m_Index)
+			{
+				for (size_t i = 0; i < values.Size; i++)
+					emplace(key, values.Data[i].second);
+			}
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+		index_type m_Index;
+		size_t m_Size;
+		size_t m_Capacity;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,721 @@
+#pragma once
+
+#include "../utility/assert.h"
+#include "../utility/empty_base.h"
+#include "../utility/meta.h"
+#include "../utility/relocatable.h"
+#include "vector_fwd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ktl
+{
+	/**
+	 * @brief A vector class, similar to std::vector, which works with non-trivial types.
+	 * When growing, trivially relocatable types are moved with a memcpy, while other types are
+	 * move constructed if their move constructor is noexcept and copy constructed otherwise.
+	 * If the allocator defines expand(), it is used to grow the memory in place, without moving any elements.
+	 * @note Specialize ktl::is_trivially_relocatable for your types to opt into relocating with memcpy
+	 * @tparam T The type to use
+	 * @tparam Alloc The type of allocator to use
+	*/
+	template<typename T, typename Alloc>
+	class vector
+	{
+	private:
+		typedef std::allocator_traits<Alloc> Traits;
+
+	public:
+		typedef T value_type;
+		typedef T* iterator;
+		typedef const T* const_iterator;
+
+		typedef std::reverse_iterator<T*> reverse_iterator;
+		typedef std::reverse_iterator<const T*> const_reverse_iterator;
+
+	public:
+		/**
+		 * @brief Construct the vector with a default constructed allocator
+		*/
+		vector() noexcept :
+			m_Alloc(),
+			m_Begin(nullptr),
+			m_End(nullptr),
+			m_EndMax(nullptr) {}
+
+		/**
+		 * @brief Construct the vector with the given allocator
+		 * @param allocator The allocator to use
+		*/
+		explicit vector(const Alloc& allocator) noexcept :
+			m_Alloc(allocator),
+			m_Begin(nullptr),
+			m_End(nullptr),
+			m_EndMax(nullptr) {}
+
+		/**
+		 * @brief Construct the vector with the given allocator and initial size of value-initialized elements
+		 * @param n The initial size of the vector
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit vector(size_t n, const Alloc& allocator = Alloc()) :
+			vector(allocator)
+		{
+			resize(n);
+		}
+
+		/**
+		 * @brief Construct the vector with the given allocator, initial size and default value
+		 * @param n The initial size of the vector
+		 * @param value The value to initialize every element as
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit vector(size_t n, const T& value, const Alloc& allocator = Alloc()) :
+			vector(allocator)
+		{
+			resize(n, value);
+		}
+
+		/**
+		 * @brief Construct the vector with the allocator and range of values
+		 * @param initializer The initial set of values
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		vector(std::initializer_list<T> initializer, const Alloc& allocator = Alloc()) :
+			vector(initializer.begin(), initializer.end(), allocator) {}
+
+		/**
+		 * @brief Construct the vector with the allocator and range of values
+		 * @param first A pointer to the first element
+		 * @param last A pointer past the last element
+		 * @param allocator The allocator to use. Will be default constructed if unspecified
+		*/
+		explicit vector(const T* first, const T* last, const Alloc& allocator = Alloc()) :
+			vector(allocator)
+		{
+			push_back(first, last);
+		}
+
+		vector(const vector& other) :
+			vector(Traits::select_on_container_copy_construction(static_cast<Alloc>(other.m_Alloc)))
+		{
+			push_back(other.m_Begin, other.m_End);
+		}
+
+		vector(vector&& other) noexcept :
+			m_Alloc(std::move(other.m_Alloc)),
+			m_Begin(other.m_Begin),
+			m_End(other.m_End),
+			m_EndMax(other.m_EndMax)
+		{
+			other.m_Begin = nullptr;
+			other.m_End = nullptr;
+			other.m_EndMax = nullptr;
+		}
+
+		vector(const vector& other, const Alloc& allocator) :
+			vector(allocator)
+		{
+			push_back(other.m_Begin, other.m_End);
+		}
+
+		vector(vector&& other, const Alloc& allocator) :
+			vector(allocator)
+		{
+			if (m_Alloc == other.m_Alloc)
+			{
+				// The memory can be deallocated by our allocator, so we can just take it
+				m_Begin = other.m_Begin;
+				m_End = other.m_End;
+				m_EndMax = other.m_EndMax;
+			}
+			else
+			{
+				// Moving using a different allocator means we have to move each element
+				reserve(other.size());
+
+				for (T* iter = other.m_Begin; iter != other.m_End; ++iter)
+					emplace_back(std::move(*iter));
+
+				other.release();
+				return;
+			}
+
+			other.m_Begin = nullptr;
+			other.m_End = nullptr;
+			other.m_EndMax = nullptr;
+		}
+
+		~vector() noexcept
+		{
+			release();
+		}
+
+		vector& operator=(const vector& other)
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Alloc = other.m_Alloc;
+
+			push_back(other.m_Begin, other.m_End);
+
+			return *this;
+		}
+
+		vector& operator=(vector&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			release();
+
+			m_Alloc = std::move(other.m_Alloc);
+			m_Begin = other.m_Begin;
+			m_End = other.m_End;
+			m_EndMax = other.m_EndMax;
+
+			other.m_Begin = nullptr;
+			other.m_End = nullptr;
+			other.m_EndMax = nullptr;
+
+			return *this;
+		}
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the array. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		T& operator[](size_t index) noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the array. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		const T& operator[](size_t index) const noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+
+		iterator begin() noexcept { return m_Begin; }
+
+		const_iterator begin() const noexcept { return m_Begin; }
+
+		iterator end() noexcept { return m_End; }
+
+		const_iterator end() const noexcept { return m_End; }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+
+		/**
+		 * @brief Returns the current size of the vector.
+		 * @return The current size of the vector in number of elements.
+		*/
+		size_t size() const noexcept { return m_End - m_Begin; }
+
+		/**
+		 * @brief Returns the current capacity of the vector.
+		 * @return The current capacity of the vector in number of elements.
+		*/
+		size_t capacity() const noexcept { return m_EndMax - m_Begin; }
+
+		/**
+		 * @brief Returns true if the vector has no elements.
+		 * @return Whether the vector has a size of 0.
+		*/
+		bool empty() const noexcept { return m_Begin == m_End; }
+
+
+		/**
+		 * @brief Returns an iterator to the start of the vector.
+		 * @return An iterator to the start of the vector.
+		*/
+		iterator data() noexcept { return m_Begin; }
+
+		/**
+		 * @brief Returns a const iterator to the start of the vector.
+		 * @return A const iterator to the start of the vector.
+		*/
+		const_iterator data() const noexcept { return m_Begin; }
+
+		/**
+		 * @brief Returns a reference to the element at @p index.
+		 * @note An index higher than size() will produce undefined behaviour.
+		 * @param index The index of the element in the vector. Must be less than size().
+		 * @return A reference to the element at @p index.
+		*/
+		T& at(size_t index) const noexcept { KTL_ASSERT(index < size()); return m_Begin[index]; }
+
+		/**
+		 * @brief Returns a reference to the first element in the vector.
+		 * @note Calling this on an empty vector will produce undefined behaviour.
+		*/
+		T& front() const noexcept { KTL_ASSERT(!empty()); return *m_Begin; }
+
+		/**
+		 * @brief Returns a reference to the last element in the vector.
+		 * @note Calling this on an empty vector will produce undefined behaviour.
+		*/
+		T& back() const noexcept { KTL_ASSERT(!empty()); return *(m_End - 1); }
+
+
+		/**
+		 * @brief Resizes the vector to the given size, value-initializing any new elements.
+		 * @param n The size to resize to.
+		*/
+		void resize(size_t n)
+		{
+			if (n <= size())
+			{
+				destroy(m_Begin + n, m_End);
+				m_End = m_Begin + n;
+				return;
+			}
+
+			if (capacity() < n)
+				expand(n - capacity());
+
+			for (T* end = m_Begin + n; m_End != end; ++m_End)
+				Traits::construct(m_Alloc, m_End);
+		}
+
+		/**
+		 * @brief Resizes the vector to the given size, copying @p value into any new elements.
+		 * @param n The size to resize to.
+		 * @param value The value to initialize new elements as.
+		*/
+		void resize(size_t n, const T& value)
+		{
+			if (n <= size())
+			{
+				destroy(m_Begin + n, m_End);
+				m_End = m_Begin + n;
+				return;
+			}
+
+			if (capacity() < n)
+			{
+				// The value may be an element in this vector
+				T copy(value);
+
+				expand(n - capacity());
+
+				for (T* end = m_Begin + n; m_End != end; ++m_End)
+					Traits::construct(m_Alloc, m_End, copy);
+			}
+			else
+			{
+				for (T* end = m_Begin + n; m_End != end; ++m_End)
+					Traits::construct(m_Alloc, m_End, value);
+			}
+		}
+
+		/**
+		 * @brief Reserves the capacity of the vector to @p n, without initializing any elements.
+		 * @param n The minimum capacity of the vector.
+		*/
+		void reserve(size_t n)
+		{
+			if (capacity() < n)
+				set_size(n);
+		}
+
+		/**
+		 * @brief Reduces the capacity of the vector to its size.
+		*/
+		void shrink_to_fit()
+		{
+			if (capacity() == size())
+				return;
+
+			if (empty())
+			{
+				release();
+			}
+			else
+			{
+				size_t n = size();
+				T* alBlock = Traits::allocate(m_Alloc, n);
+
+				try
+				{
+					relocate(alBlock);
+				}
+				catch (...)
+				{
+					Traits::deallocate(m_Alloc, alBlock, n);
+					throw;
+				}
+
+				m_Begin = alBlock;
+				m_End = m_Begin + n;
+				m_EndMax = m_End;
+			}
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by copying it.
+		 * @param value The element to copy into the vector.
+		 * @return An iterator to the element that was added.
+		*/
+		iterator push_back(const T& element)
+		{
+			return emplace_back(element);
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by moving it.
+		 * @param value The element to move into the vector.
+		 * @return An iterator to the element that was added.
+		*/
+		iterator push_back(T&& element)
+		{
+			return emplace_back(std::move(element));
+		}
+
+		/**
+		 * @brief Pushes a range of values into the vector.
+		 * @note The range must not be part of this vector.
+		 * @param first A pointer to the first element.
+		 * @param last A pointer one element past the last element.
+		 * @return An iterator to the first element that was added.
+		*/
+		iterator push_back(const T* first, const T* last)
+		{
+			const size_t n = (last - first);
+
+			if (size_t(m_EndMax - m_End) < n)
+				expand(n);
+
+			T* lastElement = m_End;
+
+			for (; first != last; ++first, ++m_End)
+				Traits::construct(m_Alloc, m_End, *first);
+
+			return lastElement;
+		}
+
+		/**
+		 * @brief Pushes a new element into the vector by constructing it.
+		 * @tparam ...Args Variadic template arguments.
+		 * @param ...args Any arguments to use in the construction of the element.
+		 * @return An iterator to the element that was added.
+		*/
+		template<typename... Args>
+		iterator emplace_back(Args&&... args)
+		{
+			if (m_End == m_EndMax)
+				return grow_emplace_back(std::forward<Args>(args)...);
+
+			Traits::construct(m_Alloc, m_End, std::forward<Args>(args)...);
+
+			return m_End++;
+		}
+
+		/**
+		 * @brief Inserts a new element into the vector at the given location by constructing it.
+		 * @tparam ...Args Variadic template arguments.
+		 * @param iter An iterator pointing to the location to insert the element at.
+		 * @param ...args Any arguments to use in the construction of the element.
+		 * @return An iterator to the element that was added.
+		*/
+		template<typename... Args>
+		iterator emplace(const_iterator iter, Args&&... args)
+		{
+			KTL_ASSERT(iter >= m_Begin && iter <= m_End);
+
+			// The iterator is invalidated if we reallocate
+			size_t index = iter - m_Begin;
+
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				// Construct it on the side, so the elements don't have to be moved back if it throws
+				alignas(T) unsigned char buffer[sizeof(T)];
+				T* value = reinterpret_cast<T*>(buffer);
+
+				Traits::construct(m_Alloc, value, std::forward<Args>(args)...);
+
+				if (m_End == m_EndMax)
+				{
+					try
+					{
+						expand(1);
+					}
+					catch (...)
+					{
+						Traits::destroy(m_Alloc, value);
+						throw;
+					}
+				}
+
+				T* element = m_Begin + index;
+
+				std::memmove(static_cast<void*>(element + 1), static_cast<const void*>(element), (m_End - element) * sizeof(T));
+				std::memcpy(static_cast<void*>(element), static_cast<const void*>(value), sizeof(T));
+
+				m_End++;
+
+				return element;
+			}
+			else
+			{
+				emplace_back(std::forward<Args>(args)...);
+
+				T* element = m_Begin + index;
+
+				std::rotate(element, m_End - 1, m_End);
+
+				return element;
+			}
+		}
+
+		/**
+		 * @brief Erases the element pointed to by the iterator.
+		 * @param iter An iterator pointing to the element.
+		 * @return An iterator pointing to the element immidiately after the erased one.
+		*/
+		iterator erase(const_iterator iter)
+		{
+			KTL_ASSERT(iter >= m_Begin && iter < m_End);
+
+			return erase(iter, iter + 1);
+		}
+
+		/**
+		 * @brief Erases all elements in a range.
+		 * @param first An iterator pointing to the first element.
+		 * @param last An iterator pointing to the location after the last element.
+		 * @return An iterator pointing to the element immidiately after the erased ones.
+		*/
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			KTL_ASSERT(first <= last);
+			KTL_ASSERT(first >= m_Begin && last <= m_End);
+
+			T* begin = const_cast<iterator>(first);
+			T* end = const_cast<iterator>(last);
+
+			if (begin == end)
+				return begin;
+
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				destroy(begin, end);
+
+				std::memmove(static_cast<void*>(begin), static_cast<const void*>(end), (m_End - end) * sizeof(T));
+
+				m_End -= (end - begin);
+			}
+			else
+			{
+				T* newEnd = std::move(end, m_End, begin);
+
+				destroy(newEnd, m_End);
+
+				m_End = newEnd;
+			}
+
+			return begin;
+		}
+
+		/**
+		 * @brief Removes the last element from the vector.
+		*/
+		void pop_back() noexcept
+		{
+			KTL_ASSERT(!empty());
+
+			Traits::destroy(m_Alloc, --m_End);
+		}
+
+		/**
+		 * @brief Clears all elements in the vector, without deallocating the memory.
+		*/
+		void clear() noexcept
+		{
+			destroy(m_Begin, m_End);
+
+			m_End = m_Begin;
+		}
+
+	private:
+		void destroy(T* first, T* last) noexcept
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (; first != last; ++first)
+					Traits::destroy(m_Alloc, first);
+			}
+		}
+
+		void release() noexcept
+		{
+			if (m_Begin)
+			{
+				destroy(m_Begin, m_End);
+
+				Traits::deallocate(m_Alloc, m_Begin, capacity());
+			}
+
+			m_Begin = nullptr;
+			m_End = nullptr;
+			m_EndMax = nullptr;
+		}
+
+		size_t grow_size(size_t n) const noexcept
+		{
+			size_t curCap = capacity();
+
+			return curCap + (std::max)(curCap / 2, n);
+		}
+
+		void expand(size_t n)
+		{
+			set_size(grow_size(n));
+		}
+
+		bool try_expand(size_t n)
+			noexcept(!detail::has_expand_v<Alloc, T*> || detail::has_nothrow_expand_v<Alloc, T*>)
+		{
+			// Try to grow the block in place, avoiding the move
+			if constexpr (detail::has_expand_v<Alloc, T*>)
+			{
+				if (m_Begin != nullptr && m_Alloc.expand(m_Begin, capacity(), n))
+				{
+					m_EndMax = m_Begin + n;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Moves every element into @p alBlock and deallocates the current block.
+		 * If copying an element throws, the current block is left unchanged and the new block must be deallocated by the caller.
+		*/
+		void relocate(T* alBlock)
+		{
+			if (!m_Begin)
+				return;
+
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				std::memcpy(static_cast<void*>(alBlock), static_cast<const void*>(m_Begin), size() * sizeof(T));
+			}
+			else
+			{
+				T* current = alBlock;
+
+				try
+				{
+					for (T* iter = m_Begin; iter != m_End; ++iter, ++current)
+						Traits::construct(m_Alloc, current, std::move_if_noexcept(*iter));
+				}
+				catch (...)
+				{
+					for (T* iter = alBlock; iter != current; ++iter)
+						Traits::destroy(m_Alloc, iter);
+
+					throw;
+				}
+
+				destroy(m_Begin, m_End);
+			}
+
+			Traits::deallocate(m_Alloc, m_Begin, capacity());
+		}
+
+		void set_size(size_t n)
+		{
+			KTL_ASSERT(n >= size());
+
+			if (try_expand(n))
+				return;
+
+			size_t curSize = size();
+			T* alBlock = Traits::allocate(m_Alloc, n);
+
+			try
+			{
+				relocate(alBlock);
+			}
+			catch (...)
+			{
+				Traits::deallocate(m_Alloc, alBlock, n);
+				throw;
+			}
+
+			m_Begin = alBlock;
+			m_End = m_Begin + curSize;
+			m_EndMax = m_Begin + n;
+		}
+
+		template<typename... Args>
+		iterator grow_emplace_back(Args&&... args)
+		{
+			size_t n = grow_size(1);
+
+			if (try_expand(n))
+			{
+				Traits::construct(m_Alloc, m_End, std::forward<Args>(args)...);
+
+				return m_End++;
+			}
+
+			size_t curSize = size();
+			T* alBlock = Traits::allocate(m_Alloc, n);
+			T* element = alBlock + curSize;
+
+			// Construct the new element first, since the arguments may refer to elements in this vector
+			try
+			{
+				Traits::construct(m_Alloc, element, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				Traits::deallocate(m_Alloc, alBlock, n);
+				throw;
+			}
+
+			try
+			{
+				relocate(alBlock);
+			}
+			catch (...)
+			{
+				Traits::destroy(m_Alloc, element);
+				Traits::deallocate(m_Alloc, alBlock, n);
+				throw;
+			}
+
+			m_Begin = alBlock;
+			m_End = element + 1;
+			m_EndMax = m_Begin + n;
+
+			return element;
+		}
+
+	private:
+		KTL_EMPTY_BASE Alloc m_Alloc;
+		T* m_Begin;
+		T* m_End;
+		T* m_EndMax;
+	};
+}
\ No newline at end of file
@@ -1,26 +1,46 @@
 #pragma once
 
 // Allocators
+#include "allocators/atomic_linear_allocator.h"
 #include "allocators/cascading.h"
 #include "allocators/debug.h"
+#include "allocators/deferred.h"
+#include "allocators/double_stack_allocator.h"
 #include "allocators/fallback.h"
+#include "allocators/frame_allocator.h"
 #include "allocators/freelist.h"
 #include "allocators/global.h"
+#include "allocators/global_new.h"
 #include "allocators/linear_allocator.h"
 #include "allocators/mallocator.h"
+#include "allocators/mmap_file_allocator.h"
 #include "allocators/null_allocator.h"
 #include "allocators/overflow.h"
+#include "allocators/pmr_allocator.h"
 #include "allocators/reference.h"
+#include "allocators/ring_allocator.h"
 #include "allocators/segragator.h"
+#include "allocators/sharded.h"
 #include "allocators/shared.h"
+#include "allocators/shm_allocator.h"
+#include "allocators/size_header.h"
 #include "allocators/stack_allocator.h"
 #include "allocators/threaded.h"
 #include "allocators/type_allocator.h"
+#include "allocators/virtual_allocator.h"
 
 // Containers
 #include "containers/binary_heap.h"
+#include "containers/indexed_heap.h"
 #include "containers/ipair.h"
+#include "containers/object_pool.h"
+#include "containers/offset_ptr.h"
 #include "containers/packed_ptr.h"
+#include "containers/slot_map.h"
+#include "containers/small_vector.h"
 #include "containers/trivial_array.h"
 #include "containers/trivial_buffer.h"
-#include "containers/trivial_vector.h"
\ No newline at end of file
+#include "containers/trivial_vector.h"
+#include "containers/unordered_map.h"
+#include "containers/unordered_multimap.h"
+#include "containers/vector.h"
\ No newline at end of file
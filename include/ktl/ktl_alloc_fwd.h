@@ -1,19 +1,30 @@
 #pragma once
 
+#include "allocators/atomic_linear_allocator_fwd.h"
 #include "allocators/cascading_fwd.h"
 #include "allocators/debug_fwd.h"
+#include "allocators/deferred_fwd.h"
+#include "allocators/double_stack_allocator_fwd.h"
 #include "allocators/fallback_fwd.h"
+#include "allocators/frame_allocator_fwd.h"
 #include "allocators/freelist_fwd.h"
 #include "allocators/global_fwd.h"
 #include "allocators/linear_allocator_fwd.h"
 #include "allocators/mallocator_fwd.h"
+#include "allocators/mmap_file_allocator_fwd.h"
 #include "allocators/overflow_fwd.h"
+#include "allocators/pmr_allocator_fwd.h"
 #include "allocators/reference_fwd.h"
+#include "allocators/ring_allocator_fwd.h"
 #include "allocators/segragator_fwd.h"
+#include "allocators/sharded_fwd.h"
 #include "allocators/shared_fwd.h"
+#include "allocators/shm_allocator_fwd.h"
+#include "allocators/size_header_fwd.h"
 #include "allocators/stack_allocator_fwd.h"
 #include "allocators/threaded_fwd.h"
 #include "allocators/type_allocator_fwd.h"
+#include "allocators/virtual_allocator_fwd.h"
 
 namespace ktl
 {
@@ -1,5 +1,12 @@
 #pragma once
 
 #include "containers/binary_heap_fwd.h"
+#include "containers/indexed_heap_fwd.h"
+#include "containers/object_pool_fwd.h"
+#include "containers/slot_map_fwd.h"
+#include "containers/small_vector_fwd.h"
 #include "containers/trivial_array_fwd.h"
-#include "containers/trivial_vector_fwd.h"
\ No newline at end of file
+#include "containers/trivial_vector_fwd.h"
+#include "containers/unordered_map_fwd.h"
+#include "containers/unordered_multimap_fwd.h"
+#include "containers/vector_fwd.h"
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdlib>
 #include <memory>
 
 // KTL_MALLOC_ALREADY_ALIGNED
@@ -26,41 +27,86 @@
 #endif
 // KTL_MALLOC_ALREADY_ALIGNED
 
+// KTL_HAS_ALIGNED_ALLOC
+#if defined(__GLIBC__) || defined(__FreeBSD__)
+#define KTL_HAS_ALIGNED_ALLOC 1
+#else
+#define KTL_HAS_ALIGNED_ALLOC 0
+#endif
+// KTL_HAS_ALIGNED_ALLOC
+
 // KTL_HAS_POSIX_MEMALIGN
-#if ((defined __QNXNTO__) || (defined _GNU_SOURCE) || ((defined _XOPEN_SOURCE) && (_XOPEN_SOURCE >= 600))) \
- && (defined _POSIX_ADVISORY_INFO) && (_POSIX_ADVISORY_INFO > 0)
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
 #define KTL_HAS_POSIX_MEMALIGN 1
 #else
 #define KTL_HAS_POSIX_MEMALIGN 0
 #endif
 // KTL_HAS_POSIX_MEMALIGN
 
-// KTL_HAS_MM_MALLOC
-#if SSE_INSTR_SET > 0
-#define KTL_HAS_MM_MALLOC 1
+// KTL_HAS_SDALLOCX
+// Define as 1 when linking with jemalloc to pass sizes on to sdallocx
+#ifndef KTL_HAS_SDALLOCX
+#define KTL_HAS_SDALLOCX 0
+#endif
+
+#if KTL_HAS_SDALLOCX
+#include <jemalloc/jemalloc.h>
+#endif
+// KTL_HAS_SDALLOCX
+
+// KTL_HAS_FREE_SIZED
+// Define as 1 when the C library provides the C23 free_sized and free_aligned_sized functions
+#ifndef KTL_HAS_FREE_SIZED
+#define KTL_HAS_FREE_SIZED 0
+#endif
+// KTL_HAS_FREE_SIZED
+
+// KTL_ALIGNED_MALLOC_USES_FREE
+// Whether everything returned from aligned_malloc can be released with free()
+#if !defined(_MSC_VER) && (KTL_HAS_ALIGNED_ALLOC || KTL_HAS_POSIX_MEMALIGN)
+#define KTL_ALIGNED_MALLOC_USES_FREE 1
 #else
-#define KTL_HAS_MM_MALLOC 0
+#define KTL_ALIGNED_MALLOC_USES_FREE 0
 #endif
-// KTL_HAS_MM_MALLOC
+// KTL_ALIGNED_MALLOC_USES_FREE
 
 namespace ktl::detail
 {
+    // The alignment which malloc is guaranteed to return
+#if KTL_HAS_MALLOC_ALIGNED
+    constexpr size_t MALLOC_ALIGNMENT = alignof(std::max_align_t) > 16 ? alignof(std::max_align_t) : 16;
+#else
+    constexpr size_t MALLOC_ALIGNMENT = alignof(std::max_align_t);
+#endif
+
+    /**
+     * @brief Allocates @p size bytes aligned to @p alignment, which must be a power of 2.
+     * Uses malloc when its guaranteed alignment is enough, and an aligned allocation otherwise.
+     * @note Must be released with aligned_free()
+    */
     inline void* aligned_malloc(size_t size, size_t alignment) noexcept
     {
-#if KTL_HAS_MALLOC_ALIGNED
-        return malloc(size);
-#elif KTL_HAS_MM_MALLOC
-        return _mm_malloc(size, alignment);
-#elif KTL_HAS_POSIX_MEMALIGN
+#if defined(_MSC_VER)
+        return _aligned_malloc(size, alignment);
+#elif KTL_ALIGNED_MALLOC_USES_FREE
+        if (alignment <= MALLOC_ALIGNMENT)
+            return std::malloc(size);
+
+#if KTL_HAS_ALIGNED_ALLOC
+        // The size must be a multiple of the alignment
+        return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#else
         void* res;
-        const int failed = posix_memalign(&res, size, alignment);
+        const int failed = posix_memalign(&res, alignment, size);
         if (failed) res = nullptr;
         return res;
-#elif defined(_MSC_VER)
-        return _aligned_malloc(size, alignment);
+#endif
 #else
+        if (alignment < sizeof(void*))
+            alignment = sizeof(void*);
+
         void* res = nullptr;
-        void* ptr = malloc(size + alignment);
+        void* ptr = std::malloc(size + alignment);
         if (ptr != nullptr)
         {
             res = reinterpret_cast<void*>((reinterpret_cast<size_t>(ptr) & ~(size_t(alignment - 1))) + alignment);
@@ -70,19 +116,49 @@ namespace ktl::detail
 #endif
     }
 
+    /**
+     * @brief Releases memory returned by aligned_malloc()
+    */
     inline void aligned_free(void* ptr) noexcept
     {
-#if KTL_HAS_MALLOC_ALIGNED
-        free(ptr);
-#elif KTL_HAS_MM_MALLOC
-        _mm_free(ptr);
-#elif KTL_HAS_POSIX_MEMALIGN
-        free(ptr);
-#elif defined(_MSC_VER)
+#if defined(_MSC_VER)
         _aligned_free(ptr);
+#elif KTL_ALIGNED_MALLOC_USES_FREE
+        std::free(ptr);
 #else
         if (ptr != 0)
-            free(*(reinterpret_cast<void**>(ptr) - 1));
+            std::free(*(reinterpret_cast<void**>(ptr) - 1));
+#endif
+    }
+
+    /**
+     * @brief Releases memory returned by aligned_malloc(), passing the size on to the C library if it can use it
+     * @param ptr The location in memory to release
+     * @param size The size that was given to aligned_malloc()
+     * @param alignment The alignment that was given to aligned_malloc()
+    */
+    inline void aligned_free(void* ptr, [[maybe_unused]] size_t size, [[maybe_unused]] size_t alignment) noexcept
+    {
+#if KTL_ALIGNED_MALLOC_USES_FREE && KTL_HAS_SDALLOCX
+        if (!ptr)
+            return;
+
+        if (alignment <= MALLOC_ALIGNMENT)
+            sdallocx(ptr, size, 0);
+        else
+            sdallocx(ptr, (size + alignment - 1) & ~(alignment - 1), MALLOCX_ALIGN(alignment));
+#elif KTL_ALIGNED_MALLOC_USES_FREE && KTL_HAS_FREE_SIZED
+        // free_sized is only valid for memory from malloc, and free_aligned_sized for memory from aligned_alloc
+        if (alignment <= MALLOC_ALIGNMENT)
+            ::free_sized(ptr, size);
+        else
+#if KTL_HAS_ALIGNED_ALLOC
+            ::free_aligned_sized(ptr, alignment, (size + alignment - 1) & ~(alignment - 1));
+#else
+            std::free(ptr);
+#endif
+#else
+        aligned_free(ptr);
 #endif
     }
 
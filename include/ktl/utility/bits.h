@@ -2,6 +2,10 @@
 
 #include <cstdint>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // _MSC_VER
+
 namespace ktl::detail
 {
 	constexpr inline uintmax_t log2(uintmax_t n) noexcept
@@ -17,4 +21,32 @@ namespace ktl::detail
 
 		return r;
 	}
+
+	/**
+	 * @brief Returns the number of trailing zero bits in @p n, which must not be 0
+	*/
+	inline uint32_t countr_zero(uint32_t n) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long r;
+		_BitScanForward(&r, n);
+		return uint32_t(r);
+#else // _MSC_VER
+		return uint32_t(__builtin_ctz(n));
+#endif // _MSC_VER
+	}
+
+	/**
+	 * @brief Returns the number of leading zero bits in @p n, which must not be 0
+	*/
+	inline uint32_t countl_zero(uint32_t n) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long r;
+		_BitScanReverse(&r, n);
+		return 31U - uint32_t(r);
+#else // _MSC_VER
+		return uint32_t(__builtin_clz(n));
+#endif // _MSC_VER
+	}
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ktl::detail
+{
+    /**
+     * @brief Returns a hash of the calling thread's id, for platforms that can't tell which CPU a thread is running on
+    */
+    inline size_t current_thread_hash() noexcept
+    {
+        static thread_local const size_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+        return hash;
+    }
+
+    /**
+     * @brief Returns the index of the CPU that the calling thread is currently running on.
+     * On glibc 2.35 and later sched_getcpu reads it from the restartable sequence area that glibc registers for every thread,
+     * so it doesn't require a syscall.
+     * @note The thread may be migrated at any point, so the result is only a hint and must not be relied on for correctness
+    */
+    inline size_t current_cpu() noexcept
+    {
+#if defined(_WIN32)
+        return size_t(GetCurrentProcessorNumber());
+#elif defined(__linux__)
+        int cpu = sched_getcpu();
+        if (cpu < 0)
+            return current_thread_hash();
+        return size_t(cpu);
+#else
+        return current_thread_hash();
+#endif
+    }
+}
\ No newline at end of file
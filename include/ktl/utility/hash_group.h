@@ -0,0 +1,166 @@
+#pragma once
+
+#include "bits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KTL_HASH_GROUP_SSE2
+#include <emmintrin.h>
+#endif // __SSE2__
+
+namespace ktl::detail
+{
+	/**
+	 * @brief A control byte in an open-addressing hash table.
+	 * The byte is either one of the special values below, or the lower 7 bits of the hash of the key in a full slot.
+	*/
+	typedef int8_t ctrl_t;
+
+	constexpr ctrl_t CTRL_EMPTY = -128;
+	constexpr ctrl_t CTRL_DELETED = -2;
+	constexpr ctrl_t CTRL_SENTINEL = -1;
+
+	constexpr bool is_full(ctrl_t ctrl) noexcept { return ctrl >= 0; }
+
+	/**
+	 * @brief Mixes the bits of a hash, since std::hash is the identity function for integers on most platforms
+	*/
+	constexpr size_t mix_hash(size_t hash) noexcept
+	{
+		if constexpr (sizeof(size_t) >= 8)
+		{
+			uint64_t h = uint64_t(hash) * 0x9E3779B97F4A7C15ULL;
+			return size_t(h ^ (h >> 32));
+		}
+		else
+		{
+			uint32_t h = uint32_t(hash) * 0x9E3779B1U;
+			return size_t(h ^ (h >> 16));
+		}
+	}
+
+	constexpr size_t hash_h1(size_t hash) noexcept { return hash >> 7; }
+
+	constexpr ctrl_t hash_h2(size_t hash) noexcept { return ctrl_t(hash & 0x7F); }
+
+	/**
+	 * @brief A mask with a bit set for every matching slot in a group
+	*/
+	class hash_bitmask
+	{
+	public:
+		static constexpr size_t WIDTH = 16;
+
+		explicit hash_bitmask(uint32_t mask) noexcept :
+			m_Mask(mask) {}
+
+		explicit operator bool() const noexcept { return m_Mask != 0; }
+
+		// The amount of unset bits before the lowest set bit
+		uint32_t trailing_zeros() const noexcept { return countr_zero(m_Mask); }
+
+		// The amount of unset bits after the highest set bit, within a group
+		uint32_t leading_zeros() const noexcept { return countl_zero(m_Mask) - (32U - uint32_t(WIDTH)); }
+
+		hash_bitmask& operator++() noexcept
+		{
+			m_Mask &= m_Mask - 1;
+			return *this;
+		}
+
+		// Allows iterating over the set bits with a range-based for loop
+		uint32_t operator*() const noexcept { return trailing_zeros(); }
+
+		hash_bitmask begin() const noexcept { return *this; }
+
+		hash_bitmask end() const noexcept { return hash_bitmask(0); }
+
+		bool operator!=(const hash_bitmask& rhs) const noexcept { return m_Mask != rhs.m_Mask; }
+
+	private:
+		uint32_t m_Mask;
+	};
+
+	/**
+	 * @brief A group of control bytes, which are probed at the same time.
+	 * Uses SSE2 when available and falls back to a scalar loop otherwise.
+	*/
+	class hash_group
+	{
+	public:
+		static constexpr size_t WIDTH = hash_bitmask::WIDTH;
+
+#ifdef KTL_HASH_GROUP_SSE2
+		explicit hash_group(const ctrl_t* ctrl) noexcept :
+			m_Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+		hash_bitmask match(ctrl_t h2) const noexcept
+		{
+			return hash_bitmask(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Ctrl))));
+		}
+
+		hash_bitmask match_empty() const noexcept
+		{
+			return match(CTRL_EMPTY);
+		}
+
+		hash_bitmask match_empty_or_deleted() const noexcept
+		{
+			// Both empty and deleted are less than the sentinel, while full slots are greater
+			return hash_bitmask(uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CTRL_SENTINEL), m_Ctrl))));
+		}
+
+		uint32_t count_leading_empty_or_deleted() const noexcept
+		{
+			uint32_t mask = uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CTRL_SENTINEL), m_Ctrl)));
+			return countr_zero(~mask);
+		}
+
+	private:
+		__m128i m_Ctrl;
+#else // KTL_HASH_GROUP_SSE2
+		explicit hash_group(const ctrl_t* ctrl) noexcept
+		{
+			std::memcpy(m_Ctrl, ctrl, WIDTH);
+		}
+
+		hash_bitmask match(ctrl_t h2) const noexcept
+		{
+			uint32_t mask = 0;
+			for (size_t i = 0; i < WIDTH; i++)
+				mask |= uint32_t(m_Ctrl[i] == h2) << i;
+
+			return hash_bitmask(mask);
+		}
+
+		hash_bitmask match_empty() const noexcept
+		{
+			return match(CTRL_EMPTY);
+		}
+
+		hash_bitmask match_empty_or_deleted() const noexcept
+		{
+			uint32_t mask = 0;
+			for (size_t i = 0; i < WIDTH; i++)
+				mask |= uint32_t(m_Ctrl[i] < CTRL_SENTINEL) << i;
+
+			return hash_bitmask(mask);
+		}
+
+		uint32_t count_leading_empty_or_deleted() const noexcept
+		{
+			uint32_t i = 0;
+			while (i < WIDTH && m_Ctrl[i] < CTRL_SENTINEL)
+				i++;
+
+			return i;
+		}
+
+	private:
+		ctrl_t m_Ctrl[WIDTH];
+#endif // KTL_HASH_GROUP_SSE2
+	};
+}
\ No newline at end of file
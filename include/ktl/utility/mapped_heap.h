@@ -0,0 +1,250 @@
+#pragma once
+
+#include "alignment.h"
+#include "assert.h"
+#include "bits.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace ktl::detail
+{
+    /**
+     * @brief The bookkeeping of a heap which lives at the start of a region of mapped memory.
+     * Everything is stored as offsets from the start of the region, so the region can be mapped at a different address every time.
+     * Memory is handed out from a bump pointer, rounded up to a power of 2,
+     * and deallocated memory is kept in a freelist per size, with the link stored in the memory itself.
+     * A small table of named roots lets whoever opens the region find the objects stored in it.
+     * @note Guarded by a spinlock inside the region, so it can be used by several threads or processes at once.
+     * A process which dies while holding the lock will leave the heap locked
+    */
+    class mapped_heap
+    {
+    private:
+        // "KTLHEAP2", which also acts as the layout version
+        static constexpr uint64_t MAGIC = 0x4B544C4845415032ULL;
+        static constexpr size_t MIN_SIZE = ALIGNMENT < sizeof(uint64_t) ? sizeof(uint64_t) : ALIGNMENT;
+        static constexpr size_t CLASSES = 48;
+        static constexpr size_t ROOTS = 16;
+        static constexpr size_t ROOT_NAME = 32;
+
+        struct root
+        {
+            char Name[ROOT_NAME];
+            uint64_t Offset;
+        };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free, "The lock must be lock-free to work across processes");
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "The header must be lock-free to work across processes");
+
+        mapped_heap(size_t size) noexcept :
+            m_Magic(0),
+            m_Lock(0),
+            m_Size(size),
+            m_Free(HEADER_SIZE),
+            m_Lists{},
+            m_Roots{} {}
+
+    public:
+        static constexpr size_t HEADER_SIZE = ((sizeof(uint64_t) * (CLASSES + 4) + sizeof(root) * ROOTS) + ALIGNMENT_MASK) & ~ALIGNMENT_MASK;
+
+        /**
+         * @brief Creates a new, empty heap at the start of @p p, overwriting whatever was there
+         * @param p The start of the region. Must be aligned to ALIGNMENT
+         * @param size The size of the region in bytes
+         * @return The heap or nullptr if the region is too small
+        */
+        static mapped_heap* create(void* p, size_t size) noexcept
+        {
+            static_assert(sizeof(mapped_heap) <= HEADER_SIZE, "The header must fit in front of the allocations");
+
+            if (!p || size <= HEADER_SIZE)
+                return nullptr;
+
+            mapped_heap* heap = new (p) mapped_heap(size);
+
+            // Publish the heap last, so that anyone opening it sees it completely initialized
+            heap->m_Magic.store(MAGIC, std::memory_order_release);
+
+            return heap;
+        }
+
+        /**
+         * @brief Opens a heap which was previously created at the start of @p p
+         * @param p The start of the region
+         * @param size The size of the region in bytes
+         * @return The heap or nullptr if the region does not contain a heap
+        */
+        static mapped_heap* open(void* p, size_t size) noexcept
+        {
+            if (!p || size <= HEADER_SIZE)
+                return nullptr;
+
+            mapped_heap* heap = static_cast<mapped_heap*>(p);
+
+            if (heap->m_Magic.load(std::memory_order_acquire) != MAGIC || heap->m_Size > size)
+                return nullptr;
+
+            return heap;
+        }
+
+        mapped_heap(const mapped_heap&) = delete;
+
+        mapped_heap& operator=(const mapped_heap&) = delete;
+
+        void* allocate(size_t n) noexcept
+        {
+            size_t index = size_class(n);
+            if (index >= CLASSES)
+                return nullptr;
+
+            uint64_t size = uint64_t(MIN_SIZE) << index;
+
+            lock();
+
+            uint64_t offset = m_Lists[index];
+            if (offset != 0)
+                m_Lists[index] = *reinterpret_cast<uint64_t*>(base() + offset);
+            else if (m_Size - m_Free >= size)
+            {
+                offset = m_Free;
+                m_Free += size;
+            }
+
+            unlock();
+
+            return offset != 0 ? base() + offset : nullptr;
+        }
+
+        void deallocate(void* p, size_t n) noexcept
+        {
+            KTL_ASSERT(owns(p));
+
+            size_t index = size_class(n);
+            uint64_t offset = uint64_t(static_cast<char*>(p) - base());
+
+            lock();
+
+            *static_cast<uint64_t*>(p) = m_Lists[index];
+            m_Lists[index] = offset;
+
+            unlock();
+        }
+
+        bool owns(void* p) const noexcept
+        {
+            uintptr_t ptr = reinterpret_cast<uintptr_t>(p);
+            uintptr_t low = reinterpret_cast<uintptr_t>(this) + HEADER_SIZE;
+            uintptr_t high = reinterpret_cast<uintptr_t>(this) + m_Size;
+
+            return ptr >= low && ptr < high;
+        }
+
+        size_t max_size() const noexcept
+        {
+            return size_t(m_Size - HEADER_SIZE);
+        }
+
+        /**
+         * @brief Returns the object which was last published under @p name
+         * @param name The name of the root
+         * @return The root object or nullptr if nothing has been published under that name
+        */
+        void* get_root(const char* name) noexcept
+        {
+            lock();
+
+            uint64_t offset = 0;
+            if (root* entry = find_root(name))
+                offset = entry->Offset;
+
+            unlock();
+
+            return offset != 0 ? base() + offset : nullptr;
+        }
+
+        /**
+         * @brief Publishes an object under @p name, so it can be found again by anyone opening the heap
+         * @param name The name of the root. Must be shorter than ROOT_NAME characters
+         * @param p The root object, which must be allocated from this heap. Passing nullptr removes the root
+         * @return Whether the root could be published. Fails if the name is too long or the table is full
+        */
+        bool set_root(const char* name, void* p) noexcept
+        {
+            KTL_ASSERT(!p || owns(p));
+
+            size_t length = std::strlen(name);
+            if (length >= ROOT_NAME)
+                return false;
+
+            lock();
+
+            root* entry = find_root(name);
+
+            // Look for an empty slot if the name hasn't been used yet
+            for (size_t i = 0; !entry && p && i < ROOTS; i++)
+            {
+                if (m_Roots[i].Offset == 0)
+                {
+                    entry = &m_Roots[i];
+                    std::memcpy(entry->Name, name, length + 1);
+                }
+            }
+
+            if (entry)
+                entry->Offset = p ? uint64_t(static_cast<char*>(p) - base()) : 0;
+
+            unlock();
+
+            return entry || !p;
+        }
+
+    private:
+        static size_t size_class(size_t n) noexcept
+        {
+            if (n <= MIN_SIZE)
+                return 0;
+
+            return size_t(log2(n - 1) + 1 - log2(MIN_SIZE));
+        }
+
+        char* base() noexcept
+        {
+            return reinterpret_cast<char*>(this);
+        }
+
+        root* find_root(const char* name) noexcept
+        {
+            for (size_t i = 0; i < ROOTS; i++)
+            {
+                if (m_Roots[i].Offset != 0 && std::strncmp(m_Roots[i].Name, name, ROOT_NAME) == 0)
+                    return &m_Roots[i];
+            }
+
+            return nullptr;
+        }
+
+        void lock() noexcept
+        {
+            while (m_Lock.exchange(1, std::memory_order_acquire) != 0)
+                std::this_thread::yield();
+        }
+
+        void unlock() noexcept
+        {
+            m_Lock.store(0, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<uint64_t> m_Magic;
+        std::atomic<uint32_t> m_Lock;
+        uint64_t m_Size;
+        uint64_t m_Free;
+        uint64_t m_Lists[CLASSES];
+        root m_Roots[ROOTS];
+    };
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ktl::detail
+{
+    /**
+     * @brief Opens or creates the file at @p path and maps it into memory, shared with anyone else who maps it.
+     * The file is grown to at least @p size bytes, but is never shrunk.
+     * @param path The path of the file
+     * @param size The minimum size to map. Is set to the size that was actually mapped
+     * @param created Is set to whether the file was empty before it was opened
+     * @return The start of the mapped memory or nullptr if the file could not be mapped
+    */
+    inline void* map_file(const char* path, size_t& size, bool& created) noexcept
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        created = fileSize.QuadPart == 0;
+        if (size_t(fileSize.QuadPart) > size)
+            size = size_t(fileSize.QuadPart);
+
+        // Creating the mapping grows the file if it is too small
+        uint64_t mapSize = uint64_t(size);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, DWORD(mapSize >> 32), DWORD(mapSize & 0xFFFFFFFF), nullptr);
+        CloseHandle(file);
+
+        if (!mapping)
+            return nullptr;
+
+        // The view keeps the mapping alive
+        void* p = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        CloseHandle(mapping);
+
+        return p;
+#else
+        int fd = open(path, O_RDWR | O_CREAT, 0644);
+        if (fd == -1)
+            return nullptr;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        created = info.st_size == 0;
+        if (size_t(info.st_size) > size)
+            size = size_t(info.st_size);
+        else if (size_t(info.st_size) < size && ftruncate(fd, off_t(size)) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        // The mapping keeps the file alive
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        return p == MAP_FAILED ? nullptr : p;
+#endif
+    }
+
+    /**
+     * @brief Opens or creates the named shared memory object and maps it into memory, so that other processes can map it too
+     * @param name The name of the object. On POSIX systems it should start with a slash
+     * @param size The size of the object if it is created. Is set to the size that was actually mapped
+     * @param created Is set to whether this call created the object
+     * @return The start of the mapped memory or nullptr if the object could not be mapped
+    */
+    inline void* map_shared(const char* name, size_t& size, bool& created) noexcept
+    {
+#if defined(_WIN32)
+        uint64_t mapSize = uint64_t(size);
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(mapSize >> 32), DWORD(mapSize & 0xFFFFFFFF), name);
+        if (!mapping)
+            return nullptr;
+
+        created = GetLastError() != ERROR_ALREADY_EXISTS;
+
+        // The view keeps the mapping alive
+        void* p = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        CloseHandle(mapping);
+
+        MEMORY_BASIC_INFORMATION info;
+        if (p && VirtualQuery(p, &info, sizeof(info)) != 0)
+            size = size_t(info.RegionSize);
+
+        return p;
+#else
+        // Only one process can create it exclusively, which decides who has to initialize it
+        int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        created = fd != -1;
+
+        if (created)
+        {
+            if (ftruncate(fd, off_t(size)) != 0)
+            {
+                close(fd);
+                shm_unlink(name);
+                return nullptr;
+            }
+        }
+        else
+        {
+            fd = shm_open(name, O_RDWR, 0600);
+            if (fd == -1)
+                return nullptr;
+
+            // The creator may not have sized the object yet
+            struct stat info;
+            bool sized = false;
+            for (size_t i = 0; i < 1000 && !sized; i++)
+            {
+                if (fstat(fd, &info) != 0)
+                    break;
+
+                sized = info.st_size != 0;
+                if (!sized)
+                    usleep(1000);
+            }
+
+            if (!sized)
+            {
+                close(fd);
+                return nullptr;
+            }
+
+            size = size_t(info.st_size);
+        }
+
+        // The mapping keeps the object alive
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        return p == MAP_FAILED ? nullptr : p;
+#endif
+    }
+
+    /**
+     * @brief Removes the named shared memory object, once every process has unmapped it
+     * @note Does nothing on Windows, where the object is removed automatically once it is no longer mapped
+     * @return Whether the object could be removed
+    */
+    inline bool unlink_shared(const char* name) noexcept
+    {
+#if defined(_WIN32)
+        return true;
+#else
+        return shm_unlink(name) == 0;
+#endif
+    }
+
+    /**
+     * @brief Writes any changes to the mapped memory back to the file
+     * @return Whether the changes could be written
+    */
+    inline bool flush_file(void* p, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        return FlushViewOfFile(p, size) != 0;
+#else
+        return msync(p, size, MS_SYNC) == 0;
+#endif
+    }
+
+    /**
+     * @brief Unmaps memory previously returned by map_file() or map_shared()
+    */
+    inline void unmap_file(void* p, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(p);
+#else
+        munmap(p, size);
+#endif
+    }
+}
\ No newline at end of file
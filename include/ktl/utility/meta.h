@@ -32,6 +32,22 @@ namespace ktl::detail
 	template<typename Alloc, typename = void>
 	using get_size_type_t = typename get_size_type<Alloc, void>::type;
 
+	// get pointer_type<T>
+	template<typename Alloc, typename T, typename = void>
+	struct get_pointer_type
+	{
+		using type = T*;
+	};
+
+	template<typename Alloc, typename T>
+	struct get_pointer_type<Alloc, T, std::void_t<typename Alloc::template pointer_type<T>>>
+	{
+		using type = typename Alloc::template pointer_type<T>;
+	};
+
+	template<typename Alloc, typename T>
+	using get_pointer_type_t = typename get_pointer_type<Alloc, T, void>::type;
+
 	// has allocate(size_t)
 	template<typename Alloc, typename = void>
 	struct has_plain_allocate : std::false_type {};
@@ -82,6 +98,46 @@ namespace ktl::detail
 	template<typename Alloc>
 	constexpr bool has_owns_v = has_owns<Alloc, void>::value;
 
+	// has expand(Ptr, size_t, size_t)
+	template<typename Alloc, typename Ptr, typename = void>
+	struct has_expand : std::false_type {};
+
+	template<typename Alloc, typename Ptr>
+	struct has_expand<Alloc, Ptr, std::void_t<decltype(std::declval<Alloc&>().expand(std::declval<Ptr>(), std::declval<size_t>(), std::declval<size_t>()))>> : std::true_type {};
+
+	template<typename Alloc, typename Ptr = void*>
+	constexpr bool has_expand_v = has_expand<Alloc, Ptr, void>::value;
+
+	// has try_deallocate(void*, size_t)
+	template<typename Alloc, typename = void>
+	struct has_try_deallocate : std::false_type {};
+
+	template<typename Alloc>
+	struct has_try_deallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().try_deallocate(std::declval<void*>(), std::declval<size_t>()))>> : std::true_type {};
+
+	template<typename Alloc>
+	constexpr bool has_try_deallocate_v = has_try_deallocate<Alloc, void>::value;
+
+	// has trim()
+	template<typename Alloc, typename = void>
+	struct has_trim : std::false_type {};
+
+	template<typename Alloc>
+	struct has_trim<Alloc, std::void_t<decltype(std::declval<Alloc&>().trim())>> : std::true_type {};
+
+	template<typename Alloc>
+	constexpr bool has_trim_v = has_trim<Alloc, void>::value;
+
+	// has reserve(size_t)
+	template<typename Alloc, typename = void>
+	struct has_reserve : std::false_type {};
+
+	template<typename Alloc>
+	struct has_reserve<Alloc, std::void_t<decltype(std::declval<Alloc&>().reserve(std::declval<size_t>()))>> : std::true_type {};
+
+	template<typename Alloc>
+	constexpr bool has_reserve_v = has_reserve<Alloc, void>::value;
+
 
 
 	// has allocate(size_t) noexcept
@@ -155,6 +211,51 @@ namespace ktl::detail
 	template<typename Alloc>
 	constexpr bool has_nothrow_owns_v = has_nothrow_owns<Alloc, void>::value;
 
+	// has expand(Ptr, size_t, size_t) noexcept
+	template<typename Alloc, typename Ptr, typename = void>
+	struct has_nothrow_expand : std::false_type {};
+
+	template<typename Alloc, typename Ptr>
+	struct has_nothrow_expand<Alloc, Ptr, std::enable_if_t<has_expand_v<Alloc, Ptr>>>
+		: std::bool_constant<noexcept(std::declval<Alloc&>().expand(std::declval<Ptr>(), std::declval<size_t>(), std::declval<size_t>()))> {};
+
+	template<typename Alloc, typename Ptr = void*>
+	constexpr bool has_nothrow_expand_v = has_nothrow_expand<Alloc, Ptr, void>::value;
+
+	// has try_deallocate(void*, size_t) noexcept, or owns(void*) and deallocate(void*, size_t) noexcept
+	template<typename Alloc, typename = void>
+	struct has_nothrow_try_deallocate
+		: std::bool_constant<has_nothrow_owns_v<Alloc> && has_nothrow_deallocate_v<Alloc>> {};
+
+	template<typename Alloc>
+	struct has_nothrow_try_deallocate<Alloc, std::enable_if_t<has_try_deallocate_v<Alloc>>>
+		: std::bool_constant<noexcept(std::declval<Alloc&>().try_deallocate(std::declval<void*>(), std::declval<size_t>()))> {};
+
+	template<typename Alloc>
+	constexpr bool has_nothrow_try_deallocate_v = has_nothrow_try_deallocate<Alloc, void>::value;
+
+	// has trim() noexcept
+	template<typename Alloc, typename = void>
+	struct has_nothrow_trim : std::false_type {};
+
+	template<typename Alloc>
+	struct has_nothrow_trim<Alloc, std::enable_if_t<has_trim_v<Alloc>>>
+		: std::bool_constant<noexcept(std::declval<Alloc&>().trim())> {};
+
+	template<typename Alloc>
+	constexpr bool has_nothrow_trim_v = has_nothrow_trim<Alloc, void>::value;
+
+	// has reserve(size_t) noexcept
+	template<typename Alloc, typename = void>
+	struct has_nothrow_reserve : std::false_type {};
+
+	template<typename Alloc>
+	struct has_nothrow_reserve<Alloc, std::enable_if_t<has_reserve_v<Alloc>>>
+		: std::bool_constant<noexcept(std::declval<Alloc&>().reserve(std::declval<size_t>()))> {};
+
+	template<typename Alloc>
+	constexpr bool has_nothrow_reserve_v = has_nothrow_reserve<Alloc, void>::value;
+
 
 
 	template<typename Alloc>
@@ -165,4 +266,23 @@ namespace ktl::detail
 		else
 			return alloc.allocate(n, source);
 	}
+
+	// Deallocates p if the allocator owns it, resolving ownership only once
+	template<typename Alloc>
+	bool try_deallocate(Alloc& alloc, void* p, size_t n) noexcept(has_nothrow_try_deallocate_v<Alloc>)
+	{
+		if constexpr (has_try_deallocate_v<Alloc>)
+		{
+			return alloc.try_deallocate(p, n);
+		}
+		else
+		{
+			if (!alloc.owns(p))
+				return false;
+
+			alloc.deallocate(p, n);
+
+			return true;
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <type_traits>
+
+namespace ktl
+{
+	/**
+	 * @brief Whether objects of type @p T can be moved to a new address with a memcpy, leaving the old memory uninitialized.
+	 * Defaults to trivially copyable types, but can be specialized for types that don't store pointers into themselves
+	 * and aren't referred to by anything else, such as most smart pointers and handles.
+	 * @note Specializing this for a type which is not trivially relocatable is undefined behaviour
+	*/
+	template<typename T>
+	struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+	template<typename T>
+	constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+}
\ No newline at end of file
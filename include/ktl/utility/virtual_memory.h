@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ktl::detail
+{
+    /**
+     * @brief Returns the granularity at which virtual memory can be committed
+    */
+    inline size_t virtual_page_size() noexcept
+    {
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return size_t(info.dwPageSize);
+#else
+        static const size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+        return page_size;
+#endif
+    }
+
+    /**
+     * @brief Reserves a range of address space without backing it with any memory
+     * @return The start of the range or nullptr if it could not be reserved
+    */
+    inline void* virtual_reserve(size_t size) noexcept
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        void* p = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+#endif
+    }
+
+    /**
+     * @brief Commits a page-aligned part of a reserved range, making it readable and writable
+     * @return Whether the memory could be committed
+    */
+    inline bool virtual_commit(void* p, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(p, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+        return mprotect(p, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    /**
+     * @brief Returns the physical memory of a page-aligned part of a reserved range to the OS.
+     * The range stays reserved, but must be committed again before use.
+    */
+    inline void virtual_decommit(void* p, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        VirtualFree(p, size, MEM_DECOMMIT);
+#else
+        madvise(p, size, MADV_DONTNEED);
+        mprotect(p, size, PROT_NONE);
+#endif
+    }
+
+    /**
+     * @brief Releases a range previously returned by virtual_reserve()
+    */
+    inline void virtual_release(void* p, size_t size) noexcept
+    {
+#if defined(_WIN32)
+        VirtualFree(p, 0, MEM_RELEASE);
+#else
+        munmap(p, size);
+#endif
+    }
+}
\ No newline at end of file
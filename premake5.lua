@@ -61,6 +61,52 @@ project "Test"
         "include/**.h"
     }
 
+    -- Replaces the global operator new, so it is built separately
+    removefiles {
+        "src/global_new/**"
+    }
+
+    includedirs {
+        "src",
+        "include"
+    }
+
+    filter "system:windows"
+        systemversion "latest"
+        
+        conformancemode "on"
+        
+        flags { "MultiProcessorCompile" }
+
+    filter "system:linux"
+        systemversion "latest"
+    
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+        
+    filter "configurations:Release"
+        flags { "LinkTimeOptimization" }
+
+        runtime "Release"
+        optimize "on"
+
+project "GlobalNewTest"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect(_OPTIONS["dialect"])
+    staticruntime "off"
+    
+    targetdir ("bin/%{outputdir}")
+    objdir ("bin-obj/%{outputdir}")
+
+    files {
+        "src/global_new/**.cpp",
+        "src/shared/**.h",
+        "src/test.cpp",
+        "include/**.h"
+    }
+
     includedirs {
         "src",
         "include"
@@ -11,14 +11,16 @@ if not p.modules.test then
             
             local res,msg,sig;
             
-            if (os.host() == "windows") then
-                res,msg,sig = os.execute("bin\\".._OPTIONS["config"].."-windows-x86_64\\Test.exe")
-            else
-                res,msg,sig = os.execute("bin/".._OPTIONS["config"].."-linux-x86_64/Test")
-            end
-            
-            if (not res and msg == "exit") then
-                error("Build "..msg.." with code: "..sig, 0)
+            for _, name in ipairs({ "Test", "GlobalNewTest" }) do
+                if (os.host() == "windows") then
+                    res,msg,sig = os.execute("bin\\".._OPTIONS["config"].."-windows-x86_64\\"..name..".exe")
+                else
+                    res,msg,sig = os.execute("bin/".._OPTIONS["config"].."-linux-x86_64/"..name)
+                end
+                
+                if (not res and msg == "exit") then
+                    error("Build "..msg.." with code: "..sig, 0)
+                end
             end
         end
     }
@@ -0,0 +1,112 @@
+#include "shared/assert_utility.h"
+#include "shared/counting_allocator.h"
+#include "shared/test.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/global.h"
+#include "ktl/allocators/global_new.h"
+#include "ktl/allocators/mallocator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+// Naming scheme: test_global_new_replace_[Type]
+// Contains tests that install ktl::global_new as the global operator new and delete
+// These are built into their own executable, since the replacement affects the whole program
+
+namespace ktl::test::global_new_replace
+{
+    typedef counting_allocator<ktl::mallocator> counting_t;
+}
+
+KTL_GLOBAL_NEW(ktl::test::global_new_replace::counting_t)
+
+namespace ktl::test::global_new_replace
+{
+    struct alignas(64) aligned_t
+    {
+        char Data[64];
+    };
+
+    // Stops the compiler from eliding new-expressions which are never used
+    inline void* volatile s_Escape;
+
+    inline counting_t& get_counter() noexcept
+    {
+        return ktl::global<counting_t>().get_allocator();
+    }
+
+    template<typename New, typename Delete>
+    void assert_routed(New&& allocate, Delete&& deallocate)
+    {
+        counting_t& counter = get_counter();
+
+        size_t allocations = counter.allocations();
+        size_t deallocations = counter.deallocations();
+        size_t allocated = counter.allocated();
+
+        void* p = allocate();
+        s_Escape = p;
+
+        KTL_TEST_ASSERT(p);
+        KTL_TEST_ASSERT(counter.allocations() == allocations + 1);
+        KTL_TEST_ASSERT(counter.allocated() > allocated);
+        KTL_TEST_ASSERT(ktl::global_new<counting_t>::owns(p));
+
+        deallocate(p);
+
+        KTL_TEST_ASSERT(counter.deallocations() == deallocations + 1);
+        KTL_TEST_ASSERT(counter.allocated() == allocated);
+    }
+
+    KTL_ADD_TEST(test_global_new_replace_expression)
+    {
+        assert_routed([]() { return new int(42); }, [](void* p) { delete static_cast<int*>(p); });
+        assert_routed([]() { return new int[16]; }, [](void* p) { delete[] static_cast<int*>(p); });
+        assert_routed([]() { return new (std::nothrow) int(42); }, [](void* p) { delete static_cast<int*>(p); });
+        assert_routed([]() { return new (std::nothrow) int[16]; }, [](void* p) { delete[] static_cast<int*>(p); });
+    }
+
+    KTL_ADD_TEST(test_global_new_replace_aligned_expression)
+    {
+        auto deallocate = [](void* p) { delete static_cast<aligned_t*>(p); };
+        auto deallocate_array = [](void* p) { delete[] static_cast<aligned_t*>(p); };
+
+        assert_routed([]() { return new aligned_t; }, deallocate);
+        assert_routed([]() { return new aligned_t[3]; }, deallocate_array);
+        assert_routed([]() { return new (std::nothrow) aligned_t; }, deallocate);
+        assert_routed([]() { return new (std::nothrow) aligned_t[3]; }, deallocate_array);
+
+        aligned_t* p = new aligned_t;
+        KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & (alignof(aligned_t) - 1)) == 0);
+        std::memset(p->Data, 0xFF, sizeof(p->Data));
+        delete p;
+    }
+
+    KTL_ADD_TEST(test_global_new_replace_operator)
+    {
+        constexpr std::align_val_t alignment = std::align_val_t(256);
+
+        // Every overload is called directly, including the sized and nothrow deletes, which expressions rarely use
+        assert_routed([]() { return ::operator new(48); }, [](void* p) { ::operator delete(p); });
+        assert_routed([]() { return ::operator new(48); }, [](void* p) { ::operator delete(p, 48); });
+        assert_routed([]() { return ::operator new(48, std::nothrow); }, [](void* p) { ::operator delete(p, std::nothrow); });
+        assert_routed([]() { return ::operator new[](48); }, [](void* p) { ::operator delete[](p); });
+        assert_routed([]() { return ::operator new[](48); }, [](void* p) { ::operator delete[](p, 48); });
+        assert_routed([]() { return ::operator new[](48, std::nothrow); }, [](void* p) { ::operator delete[](p, std::nothrow); });
+
+        assert_routed([=]() { return ::operator new(48, alignment); }, [=](void* p) { ::operator delete(p, alignment); });
+        assert_routed([=]() { return ::operator new(48, alignment); }, [=](void* p) { ::operator delete(p, 48, alignment); });
+        assert_routed([=]() { return ::operator new(48, alignment, std::nothrow); }, [=](void* p) { ::operator delete(p, alignment, std::nothrow); });
+        assert_routed([=]() { return ::operator new[](48, alignment); }, [=](void* p) { ::operator delete[](p, alignment); });
+        assert_routed([=]() { return ::operator new[](48, alignment); }, [=](void* p) { ::operator delete[](p, 48, alignment); });
+        assert_routed([=]() { return ::operator new[](48, alignment, std::nothrow); }, [=](void* p) { ::operator delete[](p, alignment, std::nothrow); });
+
+        void* p = ::operator new(48, alignment);
+        KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & 255) == 0);
+        ::operator delete(p, alignment);
+    }
+}
\ No newline at end of file
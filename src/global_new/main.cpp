@@ -0,0 +1,8 @@
+#include "shared/test.h"
+
+int main()
+{
+	ktl::test::unit::run_all_tests();
+
+	return 0;
+}
\ No newline at end of file
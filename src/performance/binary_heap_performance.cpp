@@ -0,0 +1,173 @@
+#include "shared/profiler.h"
+#include "shared/random.h"
+#include "shared/types.h"
+
+#include "ktl/containers/binary_heap.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace ktl::performance::binary_heap
+{
+    constexpr size_t HEAP_SIZE = 1000000;
+    constexpr size_t AMOUNT = 1000;
+
+    inline std::vector<trivial_t> generate_values(size_t amount)
+    {
+        std::vector<trivial_t> values(amount);
+
+        std::uniform_real_distribution<double> distribution(0.0, 1000.0);
+        for (size_t i = 0; i < amount; i++)
+            values[i] = { distribution(random_generator), distribution(random_generator) };
+
+        return values;
+    }
+
+    inline const std::vector<trivial_t> values = generate_values(AMOUNT);
+    inline const std::vector<trivial_t> large_values = generate_values(HEAP_SIZE);
+
+    // Worst case for inserting one by one, since every element has to percolate all the way up
+    inline const std::vector<trivial_t> sorted_values = []()
+    {
+        std::vector<trivial_t> values = large_values;
+        std::sort(values.begin(), values.end(), std::greater<trivial_t>());
+
+        return values;
+    }();
+
+    template<size_t Arity>
+    d_ary_min_heap<trivial_t, Arity>& get_large_heap()
+    {
+        // Filled once and reused between runs, since filling it takes far longer than the benchmark
+        static d_ary_min_heap<trivial_t, Arity> heap(large_values.data(), large_values.data() + HEAP_SIZE);
+
+        return heap;
+    }
+
+    template<size_t Arity>
+    void run_pop_benchmark()
+    {
+        auto& heap = get_large_heap<Arity>();
+
+        std::vector<trivial_t> popped(AMOUNT);
+
+        profiler::resume();
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            popped[i] = heap.pop();
+
+        profiler::pause();
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            heap.insert(popped[i]);
+    }
+
+    template<size_t Arity>
+    void run_push_pop_benchmark()
+    {
+        auto& heap = get_large_heap<Arity>();
+
+        profiler::resume();
+
+        // Keeps the size of the heap steady, like a scheduling queue would
+        for (size_t i = 0; i < AMOUNT; i++)
+        {
+            heap.pop();
+            heap.insert(values[i]);
+        }
+
+        profiler::pause();
+    }
+
+    void run_construct_benchmark(const std::vector<trivial_t>& source)
+    {
+        profiler::resume();
+
+        binary_min_heap<trivial_t> heap(source.data(), source.data() + HEAP_SIZE);
+
+        profiler::pause();
+    }
+
+    void run_construct_insert_benchmark(const std::vector<trivial_t>& source)
+    {
+        profiler::resume();
+
+        binary_min_heap<trivial_t> heap(HEAP_SIZE);
+
+        for (size_t i = 0; i < HEAP_SIZE; i++)
+            heap.insert(source[i]);
+
+        profiler::pause();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_construct_range_trivial)
+    {
+        profiler::pause();
+
+        run_construct_benchmark(large_values);
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_construct_insert_trivial)
+    {
+        profiler::pause();
+
+        run_construct_insert_benchmark(large_values);
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_construct_range_sorted_trivial)
+    {
+        profiler::pause();
+
+        run_construct_benchmark(sorted_values);
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_construct_insert_sorted_trivial)
+    {
+        profiler::pause();
+
+        run_construct_insert_benchmark(sorted_values);
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_pop_2_ary_trivial)
+    {
+        profiler::pause();
+
+        run_pop_benchmark<2>();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_pop_4_ary_trivial)
+    {
+        profiler::pause();
+
+        run_pop_benchmark<4>();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_pop_8_ary_trivial)
+    {
+        profiler::pause();
+
+        run_pop_benchmark<8>();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_push_pop_2_ary_trivial)
+    {
+        profiler::pause();
+
+        run_push_pop_benchmark<2>();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_push_pop_4_ary_trivial)
+    {
+        profiler::pause();
+
+        run_push_pop_benchmark<4>();
+    }
+
+    KTL_ADD_BENCHMARK(binary_heap_push_pop_8_ary_trivial)
+    {
+        profiler::pause();
+
+        run_push_pop_benchmark<8>();
+    }
+}
\ No newline at end of file
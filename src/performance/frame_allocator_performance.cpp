@@ -0,0 +1,53 @@
+#include "shared/profiler.h"
+#include "shared/types.h"
+
+#include "ktl/allocators/cascading.h"
+#include "ktl/allocators/frame_allocator.h"
+#include "ktl/allocators/linear_allocator.h"
+
+namespace ktl::performance::frame_allocator
+{
+    template<typename Alloc, typename Func>
+    void run_tick_benchmark(Func release)
+    {
+        profiler::pause();
+
+        auto alloc = new Alloc;
+        void** ptrs = new void*[1000];
+
+        // Simulate a few ticks of allocating and releasing per-tick data
+        for (size_t tick = 0; tick < 4; tick++)
+        {
+            profiler::resume();
+
+            for (size_t i = 0; i < 1000; i++)
+                ptrs[i] = alloc->allocate(sizeof(trivial_t));
+
+            profiler::escape(ptrs);
+
+            release(*alloc, ptrs);
+
+            profiler::pause();
+        }
+
+        delete[] ptrs;
+        delete alloc;
+    }
+
+    KTL_ADD_BENCHMARK(frame_allocator_tick_trivial)
+    {
+        run_tick_benchmark<ktl::frame_allocator<sizeof(trivial_t) * 1000>>([](auto& alloc, void**)
+        {
+            alloc.next_frame();
+        });
+    }
+
+    KTL_ADD_BENCHMARK(cascading_linear_allocator_tick_trivial)
+    {
+        run_tick_benchmark<ktl::cascading<ktl::linear_allocator<4096>>>([](auto& alloc, void** ptrs)
+        {
+            for (size_t i = 0; i < 1000; i++)
+                alloc.deallocate(ptrs[i], sizeof(trivial_t));
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "shared/profiler.h"
+#include "shared/random.h"
+
+#include "ktl/containers/binary_heap.h"
+#include "ktl/containers/indexed_heap.h"
+
+#include <utility>
+#include <vector>
+
+namespace ktl::performance::indexed_heap
+{
+    // Random weights on a grid, where each node is connected to its 4 neighbours
+    constexpr size_t WIDTH = 128;
+    constexpr size_t COUNT = WIDTH * WIDTH;
+
+    typedef std::pair<double, size_t> entry;
+
+    inline std::vector<double> generate_weights()
+    {
+        std::vector<double> weights(COUNT);
+
+        std::uniform_real_distribution<double> distribution(1.0, 10.0);
+        for (size_t i = 0; i < COUNT; i++)
+            weights[i] = distribution(random_generator);
+
+        return weights;
+    }
+
+    inline const std::vector<double> weights = generate_weights();
+
+    template<typename Func>
+    void for_each_neighbour(size_t node, Func func)
+    {
+        size_t x = node % WIDTH;
+        size_t y = node / WIDTH;
+
+        if (x > 0) func(node - 1);
+        if (x + 1 < WIDTH) func(node + 1);
+        if (y > 0) func(node - WIDTH);
+        if (y + 1 < WIDTH) func(node + WIDTH);
+    }
+
+    void run_indexed_benchmark()
+    {
+        std::vector<double> distances(COUNT, 1e300);
+        std::vector<indexed_min_heap<entry>::handle> handles(COUNT);
+
+        profiler::resume();
+
+        indexed_min_heap<entry> heap;
+
+        distances[0] = 0.0;
+        handles[0] = heap.insert({ 0.0, 0 });
+
+        while (!heap.empty())
+        {
+            auto [cost, node] = heap.pop();
+
+            for_each_neighbour(node, [&](size_t next)
+            {
+                if (cost + weights[next] < distances[next])
+                {
+                    distances[next] = cost + weights[next];
+
+                    if (heap.contains(handles[next]))
+                        heap.decrease_key(handles[next], entry{ distances[next], next });
+                    else
+                        handles[next] = heap.insert({ distances[next], next });
+                }
+            });
+        }
+
+        profiler::pause();
+    }
+
+    void run_duplicate_benchmark()
+    {
+        std::vector<double> distances(COUNT, 1e300);
+
+        profiler::resume();
+
+        binary_min_heap<entry> heap;
+
+        distances[0] = 0.0;
+        heap.insert(entry{ 0.0, 0 });
+
+        while (!heap.empty())
+        {
+            auto [cost, node] = heap.pop();
+
+            // Skip entries which have been superseded by a shorter path
+            if (cost > distances[node])
+                continue;
+
+            for_each_neighbour(node, [&](size_t next)
+            {
+                if (cost + weights[next] < distances[next])
+                {
+                    distances[next] = cost + weights[next];
+                    heap.insert(entry{ distances[next], next });
+                }
+            });
+        }
+
+        profiler::pause();
+    }
+
+    KTL_ADD_BENCHMARK(indexed_heap_dijkstra_decrease_key)
+    {
+        profiler::pause();
+
+        run_indexed_benchmark();
+    }
+
+    KTL_ADD_BENCHMARK(indexed_heap_dijkstra_binary_heap_duplicates)
+    {
+        profiler::pause();
+
+        run_duplicate_benchmark();
+    }
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include "ktl/allocators/mallocator.h"
 
+#include <cstdlib>
+
 namespace ktl::performance::mallocator
 {
     typedef type_mallocator<trivial_t> AllocType;
@@ -50,4 +52,70 @@ namespace ktl::performance::mallocator
     {
         run_benchmark<trivial_t>(perform_unordered_deallocation<trivial_t, 1000, AllocType>);
     }
+
+    template<size_t Alignment>
+    void run_aligned_benchmark()
+    {
+        profiler::pause();
+
+        void** ptrs = new void*[1000];
+
+        profiler::resume();
+
+        for (size_t i = 0; i < 1000; i++)
+            ptrs[i] = detail::aligned_malloc(sizeof(trivial_t), Alignment);
+
+        for (size_t i = 0; i < 1000; i++)
+            detail::aligned_free(ptrs[i], sizeof(trivial_t), Alignment);
+
+        profiler::pause();
+
+        delete[] ptrs;
+    }
+
+    template<size_t Alignment>
+    void run_overallocate_benchmark()
+    {
+        profiler::pause();
+
+        void** ptrs = new void*[1000];
+
+        profiler::resume();
+
+        // The manual fallback, which over-allocates and stores the original pointer in front
+        for (size_t i = 0; i < 1000; i++)
+        {
+            void* ptr = std::malloc(sizeof(trivial_t) + Alignment);
+            void* res = reinterpret_cast<void*>((reinterpret_cast<size_t>(ptr) & ~(Alignment - 1)) + Alignment);
+            *(reinterpret_cast<void**>(res) - 1) = ptr;
+            ptrs[i] = res;
+        }
+
+        for (size_t i = 0; i < 1000; i++)
+            std::free(*(reinterpret_cast<void**>(ptrs[i]) - 1));
+
+        profiler::pause();
+
+        delete[] ptrs;
+    }
+
+    KTL_ADD_BENCHMARK(mallocator_aligned_16)
+    {
+        run_aligned_benchmark<16>();
+    }
+
+    KTL_ADD_BENCHMARK(mallocator_aligned_64)
+    {
+        run_aligned_benchmark<64>();
+    }
+
+    KTL_ADD_BENCHMARK(mallocator_overallocate_16)
+    {
+        run_overallocate_benchmark<16>();
+    }
+
+    KTL_ADD_BENCHMARK(mallocator_overallocate_64)
+    {
+        run_overallocate_benchmark<64>();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "shared/profiler.h"
+#include "shared/types.h"
+
+#include "ktl/allocators/freelist.h"
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/pmr_allocator.h"
+#include "ktl/allocators/segragator.h"
+
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace ktl::performance::pmr
+{
+    template<typename T>
+    using AllocType = std::pmr::polymorphic_allocator<T>;
+
+    template<typename Resource, typename Func>
+    void run_benchmark(Func func)
+    {
+        profiler::pause();
+
+        auto resource = new Resource;
+        AllocType<trivial_t> alloc(resource);
+
+        func(alloc);
+
+        delete resource;
+    }
+
+    template<typename Resource>
+    void run_vector_benchmark()
+    {
+        profiler::pause();
+
+        auto resource = new Resource;
+
+        {
+            std::pmr::vector<trivial_t> vec(resource);
+
+            profiler::resume();
+
+            for (size_t i = 0; i < 1000; i++)
+                vec.push_back({ 42.0, 58.0 });
+
+            profiler::pause();
+        }
+
+        delete resource;
+    }
+
+    template<typename Resource>
+    void run_map_benchmark()
+    {
+        profiler::pause();
+
+        auto resource = new Resource;
+
+        {
+            std::pmr::unordered_map<size_t, trivial_t> map(resource);
+
+            profiler::resume();
+
+            for (size_t i = 0; i < 1000; i++)
+                map.emplace(i, trivial_t{ 42.0, 58.0 });
+
+            for (size_t i = 0; i < 1000; i += 2)
+                map.erase(i);
+
+            profiler::pause();
+        }
+
+        delete resource;
+    }
+
+    typedef pmr_resource<linear_allocator<65536>> LinearResource;
+
+    typedef pmr_resource<freelist<0, 16, mallocator>> FreelistResource;
+
+    typedef pmr_resource<segragator<64, freelist<0, 64, mallocator>, mallocator>> SegragatorResource;
+
+#pragma region Allocation
+    KTL_ADD_BENCHMARK(pmr_monotonic_allocate_trivial)
+    {
+        run_benchmark<std::pmr::monotonic_buffer_resource>(perform_allocation<trivial_t, 1000, AllocType<trivial_t>>);
+    }
+
+    KTL_ADD_BENCHMARK(pmr_linear_allocator_allocate_trivial)
+    {
+        run_benchmark<LinearResource>(perform_allocation<trivial_t, 1000, AllocType<trivial_t>>);
+    }
+
+    KTL_ADD_BENCHMARK(pmr_pool_deallocate_unordered_trivial)
+    {
+        run_benchmark<std::pmr::unsynchronized_pool_resource>(perform_unordered_deallocation<trivial_t, 1000, AllocType<trivial_t>>);
+    }
+
+    KTL_ADD_BENCHMARK(pmr_freelist_deallocate_unordered_trivial)
+    {
+        run_benchmark<FreelistResource>(perform_unordered_deallocation<trivial_t, 1000, AllocType<trivial_t>>);
+    }
+#pragma endregion
+
+#pragma region Containers
+    KTL_ADD_BENCHMARK(pmr_vector_push_monotonic_trivial)
+    {
+        run_vector_benchmark<std::pmr::monotonic_buffer_resource>();
+    }
+
+    KTL_ADD_BENCHMARK(pmr_vector_push_linear_allocator_trivial)
+    {
+        run_vector_benchmark<LinearResource>();
+    }
+
+    KTL_ADD_BENCHMARK(pmr_unordered_map_insert_pool_trivial)
+    {
+        run_map_benchmark<std::pmr::unsynchronized_pool_resource>();
+    }
+
+    KTL_ADD_BENCHMARK(pmr_unordered_map_insert_segragator_trivial)
+    {
+        run_map_benchmark<SegragatorResource>();
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "shared/profiler.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/allocators/ring_allocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+namespace ktl::performance::ring_allocator
+{
+    // Every allocation has a header in front of it
+    typedef type_ring_allocator<trivial_t, (sizeof(trivial_t) + detail::ALIGNMENT) * 1000> AllocType;
+
+    template<typename T, typename Func>
+    void run_benchmark(Func func)
+    {
+        profiler::pause();
+
+        AllocType alloc;
+
+        func(alloc);
+    }
+
+    KTL_ADD_BENCHMARK(ring_allocator_init)
+    {
+        auto alloc = new type_ring_allocator<trivial_t, 16384>;
+
+        profiler::pause();
+
+        delete alloc;
+    }
+
+    KTL_ADD_BENCHMARK(ring_allocator_uninit)
+    {
+        profiler::pause();
+
+        {
+            auto alloc = new type_ring_allocator<trivial_t, 16384>;
+
+            profiler::resume();
+
+            delete alloc;
+        }
+    }
+
+    KTL_ADD_BENCHMARK(ring_allocator_allocate_trivial)
+    {
+        run_benchmark<trivial_t>(perform_allocation<trivial_t, 1000, AllocType>);
+    }
+
+    KTL_ADD_BENCHMARK(ring_allocator_deallocate_ordered_trivial)
+    {
+        run_benchmark<trivial_t>(perform_ordered_deallocation<trivial_t, 1000, AllocType>);
+    }
+
+    KTL_ADD_BENCHMARK(ring_allocator_deallocate_unordered_trivial)
+    {
+        run_benchmark<trivial_t>(perform_unordered_deallocation<trivial_t, 1000, AllocType>);
+    }
+}
\ No newline at end of file
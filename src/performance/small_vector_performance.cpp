@@ -0,0 +1,77 @@
+#include "shared/profiler.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/containers/small_vector.h"
+
+#include "ktl/allocators/stack_allocator.h"
+
+#include <vector>
+
+namespace ktl::performance::small_vector
+{
+    template<typename Alloc>
+    void run_benchmark(const Alloc& alloc)
+    {
+        ktl::small_vector<trivial_t, 16, Alloc> vec(alloc);
+
+        profiler::resume();
+
+        for (size_t i = 0; i < 1000; i++)
+            vec.push_back({ 42.0, 58.0 });
+
+        profiler::pause();
+    }
+
+    template<typename Vec>
+    void run_small_benchmark()
+    {
+        profiler::resume();
+
+        // Many short-lived vectors, which never outgrow the inline storage
+        for (size_t i = 0; i < 1000; i++)
+        {
+            Vec vec;
+
+            for (size_t j = 0; j < 8; j++)
+                vec.push_back({ 42.0, 58.0 });
+
+            profiler::escape(vec.data());
+        }
+
+        profiler::pause();
+    }
+
+    KTL_ADD_BENCHMARK(small_vector_push_std_allocator_trivial)
+    {
+        profiler::pause();
+
+        run_benchmark(std::allocator<trivial_t>());
+    }
+
+    KTL_ADD_BENCHMARK(small_vector_push_stack_allocator_trivial)
+    {
+        profiler::pause();
+
+        auto block = new stack<65536>;
+        type_stack_allocator<trivial_t, 65536> alloc(block);
+
+        run_benchmark(alloc);
+
+        delete block;
+    }
+
+    KTL_ADD_BENCHMARK(small_vector_push_small_trivial)
+    {
+        profiler::pause();
+
+        run_small_benchmark<ktl::small_vector<trivial_t, 8>>();
+    }
+
+    KTL_ADD_BENCHMARK(small_vector_push_small_std_vector_trivial)
+    {
+        profiler::pause();
+
+        run_small_benchmark<std::vector<trivial_t>>();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "shared/profiler.h"
+#include "shared/random.h"
+#include "shared/types.h"
+
+#include "ktl/containers/unordered_map.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ktl::performance::unordered_map
+{
+    constexpr size_t AMOUNT = 1000;
+
+    // Keys which are in the map and keys which are not
+    inline std::vector<size_t> generate_keys(size_t offset)
+    {
+        std::vector<size_t> keys(AMOUNT);
+
+        std::uniform_int_distribution<size_t> distribution;
+        for (size_t i = 0; i < AMOUNT; i++)
+            keys[i] = (distribution(random_generator) & ~size_t(1)) + offset;
+
+        return keys;
+    }
+
+    inline const std::vector<size_t> hit_keys = generate_keys(0);
+    inline const std::vector<size_t> miss_keys = generate_keys(1);
+
+    template<typename Map>
+    void run_insert_benchmark()
+    {
+        Map map;
+
+        profiler::resume();
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            map.insert({ hit_keys[i], trivial_t{ 42.0, 58.0 } });
+
+        profiler::pause();
+    }
+
+    template<typename Map>
+    void run_find_benchmark(const std::vector<size_t>& keys)
+    {
+        Map map;
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            map.insert({ hit_keys[i], trivial_t{ 42.0, 58.0 } });
+
+        volatile size_t found = 0;
+
+        profiler::resume();
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            found = found + (map.find(keys[i]) != map.end());
+
+        profiler::pause();
+    }
+
+    template<typename Map>
+    void run_erase_benchmark()
+    {
+        Map map;
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            map.insert({ hit_keys[i], trivial_t{ 42.0, 58.0 } });
+
+        profiler::resume();
+
+        for (size_t i = 0; i < AMOUNT; i++)
+            map.erase(hit_keys[i]);
+
+        profiler::pause();
+    }
+
+    typedef ktl::unordered_map<size_t, trivial_t> ktl_map_type;
+    typedef std::unordered_map<size_t, trivial_t> std_map_type;
+
+    KTL_ADD_BENCHMARK(unordered_map_insert)
+    {
+        profiler::pause();
+
+        run_insert_benchmark<ktl_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_insert_std)
+    {
+        profiler::pause();
+
+        run_insert_benchmark<std_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_find_hit)
+    {
+        profiler::pause();
+
+        run_find_benchmark<ktl_map_type>(hit_keys);
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_find_hit_std)
+    {
+        profiler::pause();
+
+        run_find_benchmark<std_map_type>(hit_keys);
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_find_miss)
+    {
+        profiler::pause();
+
+        run_find_benchmark<ktl_map_type>(miss_keys);
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_find_miss_std)
+    {
+        profiler::pause();
+
+        run_find_benchmark<std_map_type>(miss_keys);
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_erase)
+    {
+        profiler::pause();
+
+        run_erase_benchmark<ktl_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_map_erase_std)
+    {
+        profiler::pause();
+
+        run_erase_benchmark<std_map_type>();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "shared/profiler.h"
+#include "shared/types.h"
+
+#include "ktl/containers/unordered_multimap.h"
+
+#include <unordered_map>
+
+namespace ktl::performance::unordered_multimap
+{
+    // Few keys with many values each
+    constexpr size_t KEYS = 10;
+    constexpr size_t AMOUNT = 1000;
+
+    template<typename Map>
+    void fill(Map& map)
+    {
+        for (size_t i = 0; i < AMOUNT; i++)
+            map.insert({ i % KEYS, trivial_t{ double(i), 58.0 } });
+    }
+
+    template<typename Map>
+    void run_insert_benchmark()
+    {
+        Map map;
+
+        profiler::resume();
+
+        fill(map);
+
+        profiler::pause();
+    }
+
+    template<typename Map>
+    void run_equal_range_benchmark()
+    {
+        Map map;
+
+        fill(map);
+
+        volatile double sum = 0.0;
+
+        profiler::resume();
+
+        for (size_t key = 0; key < KEYS; key++)
+        {
+            auto [first, last] = map.equal_range(key);
+
+            for (auto iter = first; iter != last; ++iter)
+                sum = sum + iter->second.gCost;
+        }
+
+        profiler::pause();
+    }
+
+    template<typename Map>
+    void run_erase_benchmark()
+    {
+        Map map;
+
+        fill(map);
+
+        profiler::resume();
+
+        for (size_t key = 0; key < KEYS; key++)
+            map.erase(key);
+
+        profiler::pause();
+    }
+
+    typedef ktl::unordered_multimap<size_t, trivial_t> ktl_map_type;
+    typedef std::unordered_multimap<size_t, trivial_t> std_map_type;
+
+    KTL_ADD_BENCHMARK(unordered_multimap_insert)
+    {
+        profiler::pause();
+
+        run_insert_benchmark<ktl_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_multimap_insert_std)
+    {
+        profiler::pause();
+
+        run_insert_benchmark<std_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_multimap_equal_range)
+    {
+        profiler::pause();
+
+        run_equal_range_benchmark<ktl_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_multimap_equal_range_std)
+    {
+        profiler::pause();
+
+        run_equal_range_benchmark<std_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_multimap_erase_key)
+    {
+        profiler::pause();
+
+        run_erase_benchmark<ktl_map_type>();
+    }
+
+    KTL_ADD_BENCHMARK(unordered_multimap_erase_key_std)
+    {
+        profiler::pause();
+
+        run_erase_benchmark<std_map_type>();
+    }
+}
\ No newline at end of file
@@ -24,9 +24,9 @@ namespace ktl::test
         delete[] random_copy;
     }
 
-    template<typename T, typename Comp, typename Alloc>
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
     typename std::enable_if<std::is_same_v<T, double>, void>::type
-    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc>& heap)
+    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc, Arity>& heap)
     {
         constexpr size_t size = 8;
 
@@ -46,9 +46,9 @@ namespace ktl::test
         assert_binary_heap_insert_pop(heap, values, size);
     }
 
-    template<typename T, typename Comp, typename Alloc>
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
     typename std::enable_if<std::is_same<T, trivial_t>::value, void>::type
-    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc>& heap)
+    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc, Arity>& heap)
     {
         constexpr size_t size = 8;
 
@@ -68,9 +68,9 @@ namespace ktl::test
         assert_binary_heap_insert_pop(heap, values, size);
     }
 
-    template<typename T, typename Comp, typename Alloc>
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
     typename std::enable_if<std::is_same<T, packed_t>::value, void>::type
-    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc>& heap)
+    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc, Arity>& heap)
     {
         constexpr size_t size = 8;
 
@@ -93,9 +93,9 @@ namespace ktl::test
         assert_binary_heap_insert_pop(heap, values, size);
     }
 
-    template<typename T, typename Comp, typename Alloc>
+    template<typename T, typename Comp, typename Alloc, size_t Arity>
     typename std::enable_if<std::is_same<T, complex_t>::value, void>::type
-    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc>& heap)
+    assert_binary_heap(ktl::binary_heap<T, Comp, Alloc, Arity>& heap)
     {
         constexpr size_t size = 8;
 
@@ -137,4 +137,24 @@ namespace ktl::test
             assert_binary_heap<T>(max_heap);
         }
     }
+
+    template<typename T, size_t Arity, typename Alloc = std::allocator<T>>
+    void assert_d_ary_heap_min_max()
+    {
+        d_ary_min_heap<T, Arity, Alloc> min_heap;
+        assert_binary_heap<T>(min_heap);
+
+        d_ary_max_heap<T, Arity, Alloc> max_heap;
+        assert_binary_heap<T>(max_heap);
+
+        // Enough elements for the heap to be a few levels deep
+        constexpr size_t size = 256;
+
+        double values[size];
+        for (size_t i = 0; i < size; i++)
+            values[i] = double(i);
+
+        d_ary_min_heap<double, Arity> large_heap;
+        assert_binary_heap_insert_pop(large_heap, values, size);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ktl::test
+{
+    /**
+     * @brief A raw allocator which wraps another allocator and counts its allocations, deallocations and the amount of bytes currently allocated
+     * @tparam Alloc The allocator to wrap, usually a mallocator
+    */
+    template<typename Alloc>
+    class counting_allocator
+    {
+    public:
+        counting_allocator() noexcept = default;
+
+        bool operator==(const counting_allocator& rhs) const noexcept
+        {
+            return m_Alloc == rhs.m_Alloc;
+        }
+
+        bool operator!=(const counting_allocator& rhs) const noexcept
+        {
+            return m_Alloc != rhs.m_Alloc;
+        }
+
+        void* allocate(size_t n) noexcept
+        {
+            m_Allocations++;
+            m_Allocated += n;
+
+            return m_Alloc.allocate(n);
+        }
+
+        void deallocate(void* p, size_t n) noexcept
+        {
+            m_Deallocations++;
+            m_Allocated -= n;
+
+            m_Alloc.deallocate(p, n);
+        }
+
+        size_t allocations() const noexcept
+        {
+            return m_Allocations;
+        }
+
+        size_t deallocations() const noexcept
+        {
+            return m_Deallocations;
+        }
+
+        size_t allocated() const noexcept
+        {
+            return m_Allocated;
+        }
+
+    private:
+        Alloc m_Alloc;
+        size_t m_Allocations = 0;
+        size_t m_Deallocations = 0;
+        size_t m_Allocated = 0;
+    };
+}
\ No newline at end of file
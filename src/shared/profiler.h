@@ -74,6 +74,20 @@ namespace ktl::performance
 			s_Paused = false;
 		}
 
+		/**
+		 * @brief Stops the compiler from optimizing away the work that produced the memory at @p p, by pretending to read it
+		 * @param p The memory which would otherwise be unused
+		*/
+		static inline void escape(const void* p) noexcept
+		{
+#if defined(_MSC_VER)
+			static const void* volatile s_Sink;
+			s_Sink = p;
+#else
+			asm volatile("" : : "g"(p) : "memory");
+#endif
+		}
+
 		static void add_benchmark(const char* name, FuncPtr func_ptr);
 		static void run_all_benchmarks();
 	};
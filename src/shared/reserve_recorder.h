@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ktl::test
+{
+    /**
+     * @brief A raw allocator which records the amount of bytes it is asked to reserve, but never allocates anything itself
+     * @note Reserving succeeds as long as the requested amount fits within the given capacity
+    */
+    class reserve_recorder
+    {
+    public:
+        reserve_recorder(size_t& reserved, size_t capacity) noexcept :
+            m_Reserved(&reserved),
+            m_Capacity(capacity) {}
+
+        bool operator==(const reserve_recorder& rhs) const noexcept
+        {
+            return m_Reserved == rhs.m_Reserved;
+        }
+
+        bool operator!=(const reserve_recorder& rhs) const noexcept
+        {
+            return m_Reserved != rhs.m_Reserved;
+        }
+
+        void* allocate(size_t) noexcept
+        {
+            return nullptr;
+        }
+
+        void deallocate(void*, size_t) noexcept {}
+
+        bool owns(void*) const noexcept
+        {
+            return false;
+        }
+
+        bool reserve(size_t n) noexcept
+        {
+            *m_Reserved += n;
+
+            return n <= m_Capacity;
+        }
+
+    private:
+        size_t* m_Reserved;
+        size_t m_Capacity;
+    };
+}
\ No newline at end of file
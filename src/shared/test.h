@@ -19,7 +19,7 @@ namespace ktl::test
 	public:
 		typedef void (*test_ptr_t)();
 
-		inline constexpr static size_t MAX_TESTS = 256;
+		inline constexpr static size_t MAX_TESTS = 512;
 
 	private:
 		inline static test_ptr_t s_TestFunctions[MAX_TESTS];
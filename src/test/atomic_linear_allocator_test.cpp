@@ -0,0 +1,138 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/atomic_linear_allocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Naming scheme: test_atomic_linear_allocator_[Type]
+// Contains tests that relate directly to the ktl::atomic_linear_allocator
+
+namespace ktl::test::atomic_linear_allocator
+{
+    KTL_ADD_TEST(test_atomic_linear_raw_allocate)
+    {
+        ktl::atomic_linear_allocator<4096> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_atomic_linear_allocator_unordered_double)
+    {
+        type_atomic_linear_allocator<double, 4096> alloc;
+        assert_unordered_values<double>(alloc);
+    }
+
+    KTL_ADD_TEST(test_atomic_linear_allocator_unordered_packed)
+    {
+        type_atomic_linear_allocator<packed_t, 4096> alloc;
+        assert_unordered_values<packed_t>(alloc);
+    }
+
+    KTL_ADD_TEST(test_atomic_linear_allocator_reset)
+    {
+        ktl::atomic_linear_allocator<64> alloc;
+
+        void* p1 = alloc.allocate(32);
+        void* p2 = alloc.allocate(32);
+
+        KTL_TEST_ASSERT(p1);
+        KTL_TEST_ASSERT(p2);
+        KTL_TEST_ASSERT(!alloc.allocate(16));
+
+        // Deallocating the first allocation doesn't free up any space
+        alloc.deallocate(p1, 32);
+        KTL_TEST_ASSERT(!alloc.allocate(16));
+
+        // But deallocating the last one should reclaim everything
+        alloc.deallocate(p2, 32);
+
+        void* p3 = alloc.allocate(64);
+
+        KTL_TEST_ASSERT(p3 == p1);
+
+        alloc.deallocate(p3, 64);
+    }
+
+    KTL_ADD_TEST(test_atomic_linear_allocator_expand)
+    {
+        ktl::atomic_linear_allocator<256> alloc;
+
+        void* p1 = alloc.allocate(16);
+        void* p2 = alloc.allocate(16);
+
+        // Only the last allocation can be expanded
+        KTL_TEST_ASSERT(!alloc.expand(p1, 16, 32));
+        KTL_TEST_ASSERT(alloc.expand(p2, 16, 64));
+        KTL_TEST_ASSERT(!alloc.expand(p2, 64, 512));
+
+        alloc.deallocate(p2, 64);
+        alloc.deallocate(p1, 16);
+    }
+
+    KTL_ADD_TEST(test_atomic_linear_allocator_threaded)
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t iterations = 10000;
+
+        ktl::atomic_linear_allocator<threads * 64 * sizeof(size_t)> alloc;
+        std::atomic<bool> corrupted(false);
+
+        auto worker = [&](size_t id)
+        {
+            size_t* ptrs[8];
+
+            for (size_t i = 0; i < iterations; i++)
+            {
+                // Allocations may fail while other threads fill the arena
+                size_t count = 0;
+                for (; count < 8; count++)
+                {
+                    ptrs[count] = static_cast<size_t*>(alloc.allocate(sizeof(size_t)));
+                    if (!ptrs[count])
+                        break;
+
+                    *ptrs[count] = id;
+                }
+
+                for (size_t j = 0; j < count; j++)
+                {
+                    if (*ptrs[j] != id)
+                        corrupted.store(true);
+
+                    alloc.deallocate(ptrs[j], sizeof(size_t));
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < threads; i++)
+            workers.emplace_back(worker, i);
+
+        for (auto& thread : workers)
+            thread.join();
+
+        KTL_TEST_ASSERT(!corrupted.load());
+
+        // Everything was deallocated, so the whole arena should be available again
+        void* p = alloc.allocate(threads * 64 * sizeof(size_t));
+        KTL_TEST_ASSERT(p);
+        alloc.deallocate(p, threads * 64 * sizeof(size_t));
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_atomic_linear_allocator_std_vector_double)
+    {
+        std::vector<double, type_shared_atomic_linear_allocator<double, 4096>> vec;
+        assert_vector_values<double>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
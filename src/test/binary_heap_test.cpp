@@ -1,6 +1,7 @@
 #include "shared/assert_utility.h"
 #include "shared/binary_heap_utility.h"
 #include "shared/construct_utility.h"
+#include "shared/counting_allocator.h"
 #include "shared/test.h"
 #include "shared/types.h"
 
@@ -79,7 +80,85 @@ namespace ktl::test::binary_heap
         });
     }
 
+    KTL_ADD_TEST(test_binary_heap_range_construct)
+    {
+        constexpr size_t size = 256;
+
+        double values[size];
+        for (size_t i = 0; i < size; i++)
+            values[i] = double(i);
+
+        std::shuffle(values, values + size, random_generator);
+
+        ktl::binary_min_heap<double> min_heap(values, values + size);
+        ktl::binary_max_heap<double> max_heap(values, values + size);
+        ktl::d_ary_min_heap<double, 4> d_ary_heap(values, values + size);
+
+        KTL_TEST_ASSERT(min_heap.size() == size);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            KTL_TEST_ASSERT(min_heap.pop() == double(i));
+            KTL_TEST_ASSERT(max_heap.pop() == double(size - i - 1));
+            KTL_TEST_ASSERT(d_ary_heap.pop() == double(i));
+        }
+    }
+
+    KTL_ADD_TEST(test_binary_heap_range_insert)
+    {
+        constexpr size_t size = 256;
+
+        double values[size];
+        for (size_t i = 0; i < size; i++)
+            values[i] = double(i);
+
+        std::shuffle(values, values + size, random_generator);
+
+        ktl::binary_min_heap<double> heap;
+
+        // More elements than in the heap, so it is rebuilt
+        heap.insert(values, values + 64);
+        heap.insert(values + 64, values + 192);
+
+        // Fewer elements than in the heap, so they are inserted one by one
+        heap.insert(values + 192, values + size);
+
+        KTL_TEST_ASSERT(heap.size() == size);
+
+        for (size_t i = 0; i < size; i++)
+            KTL_TEST_ASSERT(heap.pop() == double(i));
+    }
+
 #pragma region std::allocator
+    KTL_ADD_TEST(test_binary_heap_move_allocator)
+    {
+        typedef type_allocator<complex_t, shared<counting_allocator<ktl::mallocator>>> Alloc;
+
+        Alloc alloc;
+        Alloc other;
+
+        {
+            ktl::binary_min_heap<complex_t, Alloc> heap(alloc);
+
+            for (size_t i = 0; i < 16; i++)
+                heap.insert(complex_t(double(16 - i)));
+
+            // Moving with a different allocator has to move the elements into new memory
+            ktl::binary_min_heap<complex_t, Alloc> moved(std::move(heap), other);
+
+            KTL_TEST_ASSERT(heap.empty());
+            KTL_TEST_ASSERT(moved.size() == 16);
+
+            // The old memory should be deallocated with the same size it was allocated with
+            KTL_TEST_ASSERT(alloc.get_allocator().get_allocator().allocated() == 0);
+
+            for (size_t i = 0; i < 16; i++)
+                KTL_TEST_ASSERT(moved.pop() == complex_t(double(i + 1)));
+        }
+
+        KTL_TEST_ASSERT(other.get_allocator().get_allocator().allocated() == 0);
+    }
+
     KTL_ADD_TEST(test_binary_heap_std_double)
     {
         assert_binary_heap_min_max<double, std::allocator<double>>();
@@ -170,4 +249,26 @@ namespace ktl::test::binary_heap
         assert_binary_heap_min_max<complex_t, type_stack_allocator<complex_t, 4096>>(block);
     }
 #pragma endregion
+
+#pragma region d-ary
+    KTL_ADD_TEST(test_binary_heap_4_ary_trivial)
+    {
+        assert_d_ary_heap_min_max<trivial_t, 4>();
+    }
+
+    KTL_ADD_TEST(test_binary_heap_4_ary_complex)
+    {
+        assert_d_ary_heap_min_max<complex_t, 4>();
+    }
+
+    KTL_ADD_TEST(test_binary_heap_8_ary_trivial)
+    {
+        assert_d_ary_heap_min_max<trivial_t, 8>();
+    }
+
+    KTL_ADD_TEST(test_binary_heap_8_ary_complex)
+    {
+        assert_d_ary_heap_min_max<complex_t, 8>();
+    }
+#pragma endregion
 }
\ No newline at end of file
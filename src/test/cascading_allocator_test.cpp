@@ -26,4 +26,28 @@ namespace ktl::test::cascading_allocator
         type_cascading_allocator<double, linear_allocator<32>> alloc;
         assert_unordered_values<double>(alloc);
     }
+
+    KTL_ADD_TEST(test_cascading_linear_trim)
+    {
+        cascading<linear_allocator<32>> alloc;
+
+        void* p1 = alloc.allocate(32);
+        void* p2 = alloc.allocate(32);
+
+        KTL_TEST_ASSERT(alloc.owns(p1));
+        KTL_TEST_ASSERT(alloc.owns(p2));
+
+        alloc.deallocate(p2, 32);
+
+        // The first instance is still in use, so only the empty one in front should be deleted
+        alloc.trim();
+
+        KTL_TEST_ASSERT(alloc.owns(p1));
+        KTL_TEST_ASSERT(!alloc.owns(p2));
+
+        alloc.deallocate(p1, 32);
+        alloc.trim();
+
+        KTL_TEST_ASSERT(!alloc.owns(p1));
+    }
 }
\ No newline at end of file
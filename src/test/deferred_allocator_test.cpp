@@ -0,0 +1,124 @@
+#include "shared/allocation_utility.h"
+#include "shared/counting_allocator.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/deferred.h"
+#include "ktl/allocators/freelist.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Naming scheme: test_deferred_allocator_[Type]
+// Contains tests that relate directly to the ktl::deferred
+
+namespace ktl::test::deferred_allocator
+{
+    KTL_ADD_TEST(test_deferred_raw_allocate)
+    {
+        ktl::deferred<ktl::freelist<0, 64, ktl::mallocator>> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_deferred_pinned_reader)
+    {
+        ktl::deferred<counting_allocator<ktl::mallocator>, 4> alloc;
+
+        void* p = alloc.allocate(16);
+
+        {
+            // Pin a reader before the memory is retired
+            decltype(alloc)::guard guard(alloc);
+
+            alloc.deallocate(p, 16);
+
+            // The reader is still in the current epoch, so it can advance once
+            KTL_TEST_ASSERT(alloc.collect());
+            KTL_TEST_ASSERT(alloc.get_allocator().deallocations() == 0);
+
+            // But not again until the reader leaves
+            KTL_TEST_ASSERT(!alloc.collect());
+            KTL_TEST_ASSERT(alloc.get_allocator().deallocations() == 0);
+        }
+
+        KTL_TEST_ASSERT(alloc.collect());
+        KTL_TEST_ASSERT(alloc.get_allocator().deallocations() == 1);
+    }
+
+    KTL_ADD_TEST(test_deferred_batch_release)
+    {
+        ktl::deferred<counting_allocator<ktl::mallocator>, 4> alloc;
+
+        // Retiring a few batches without any readers should release most of them
+        for (size_t i = 0; i < 256; i++)
+            alloc.deallocate(alloc.allocate(8), 8);
+
+        KTL_TEST_ASSERT(alloc.get_allocator().deallocations() > 0);
+        KTL_TEST_ASSERT(alloc.get_allocator().deallocations() < 256);
+    }
+
+    KTL_ADD_TEST(test_deferred_threaded_readers)
+    {
+        ktl::deferred<ktl::mallocator, 8> alloc;
+        std::atomic<size_t*> value(static_cast<size_t*>(alloc.allocate(sizeof(size_t))));
+        std::atomic<bool> done(false);
+        std::atomic<bool> corrupted(false);
+
+        *value.load() = 42;
+
+        auto reader = [&]
+        {
+            while (!done.load())
+            {
+                decltype(alloc)::guard guard(alloc);
+
+                if (*value.load() != 42)
+                    corrupted.store(true);
+            }
+        };
+
+        std::thread thread1(reader);
+        std::thread thread2(reader);
+
+        // Continuously replace the shared value and retire the old one
+        for (size_t i = 0; i < 10000; i++)
+        {
+            size_t* next = static_cast<size_t*>(alloc.allocate(sizeof(size_t)));
+            *next = 42;
+
+            size_t* prev = value.exchange(next);
+            alloc.deallocate(prev, sizeof(size_t));
+        }
+
+        done.store(true);
+
+        thread1.join();
+        thread2.join();
+
+        alloc.deallocate(value.load(), sizeof(size_t));
+
+        KTL_TEST_ASSERT(!corrupted.load());
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_deferred_std_vector_double)
+    {
+        std::vector<double, type_shared_deferred<double, ktl::mallocator>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_deferred_std_vector_complex)
+    {
+        std::vector<complex_t, type_shared_deferred<complex_t, ktl::mallocator>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/double_stack_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <vector>
+
+// Naming scheme: test_double_stack_allocator_[Type]
+// Contains tests that relate directly to the ktl::double_stack_allocator
+
+namespace ktl::test::double_stack_allocator
+{
+    template<typename T, bool Top = false>
+    using Alloc = ktl::type_double_stack_allocator<T, 4096, Top>;
+
+    KTL_ADD_TEST(test_double_stack_allocator_raw_allocate_bottom)
+    {
+        double_stack<4096> block;
+        ktl::double_stack_allocator<4096> alloc(block);
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_raw_allocate_top)
+    {
+        double_stack<4096> block;
+        ktl::double_stack_allocator<4096, true> alloc(block);
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_unordered_double)
+    {
+        double_stack<4096> block;
+        Alloc<double> bottom(block);
+        Alloc<double, true> top(block);
+        assert_unordered_values<double>(bottom);
+        assert_unordered_values<double>(top);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_shared_capacity)
+    {
+        double_stack<1024> block;
+        ktl::double_stack_allocator<1024> bottom(block);
+        ktl::double_stack_allocator<1024, true> top(block);
+
+        void* p1 = bottom.allocate(512);
+        void* p2 = top.allocate(256);
+
+        KTL_TEST_ASSERT(p1 != nullptr);
+        KTL_TEST_ASSERT(p2 != nullptr);
+        KTL_TEST_ASSERT(bottom.owns(p1) && !bottom.owns(p2));
+        KTL_TEST_ASSERT(top.owns(p2) && !top.owns(p1));
+
+        // The ends share the space between them
+        KTL_TEST_ASSERT(top.allocate(512) == nullptr);
+        KTL_TEST_ASSERT(bottom.allocate(512) == nullptr);
+
+        void* p3 = top.allocate(256);
+        KTL_TEST_ASSERT(p3 == static_cast<char*>(p1) + 512);
+        KTL_TEST_ASSERT(bottom.allocate(16) == nullptr);
+
+        top.deallocate(p3, 256);
+        top.deallocate(p2, 256);
+        bottom.deallocate(p1, 512);
+
+        KTL_TEST_ASSERT(bottom.get_marker() == 0);
+        KTL_TEST_ASSERT(top.get_marker() == 0);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_rewind)
+    {
+        double_stack<1024> block;
+        ktl::double_stack_allocator<1024> bottom(block);
+        ktl::double_stack_allocator<1024, true> top(block);
+
+        void* persistent = bottom.allocate(64);
+
+        size_t bottomMarker = bottom.get_marker();
+        size_t topMarker = top.get_marker();
+
+        // Scratch data from both ends
+        for (size_t i = 0; i < 4; i++)
+        {
+            KTL_TEST_ASSERT(bottom.allocate(32) != nullptr);
+            KTL_TEST_ASSERT(top.allocate(32) != nullptr);
+        }
+
+        // Rewinding one end shouldn't affect the other
+        top.rewind(topMarker);
+
+        KTL_TEST_ASSERT(top.get_marker() == topMarker);
+        KTL_TEST_ASSERT(bottom.get_marker() == bottomMarker + 4 * 32);
+
+        bottom.rewind(bottomMarker);
+
+        KTL_TEST_ASSERT(bottom.get_marker() == bottomMarker);
+        KTL_TEST_ASSERT(bottom.owns(persistent));
+
+        bottom.rewind();
+
+        KTL_TEST_ASSERT(bottom.get_marker() == 0);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_expand)
+    {
+        double_stack<1024> block;
+        ktl::double_stack_allocator<1024> bottom(block);
+        ktl::double_stack_allocator<1024, true> top(block);
+
+        void* p1 = bottom.allocate(64);
+        void* p2 = top.allocate(64);
+
+        // Only the bottom can grow in place, until it meets the top
+        KTL_TEST_ASSERT(!top.expand(p2, 64, 128));
+        KTL_TEST_ASSERT(bottom.expand(p1, 64, 1024 - 64));
+        KTL_TEST_ASSERT(!bottom.expand(p1, 1024 - 64, 1024));
+
+        top.deallocate(p2, 64);
+        bottom.deallocate(p1, 1024 - 64);
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_double_stack_allocator_std_vector_double)
+    {
+        double_stack<4096> block;
+        Alloc<double> alloc(block);
+        std::vector<double, Alloc<double>> vec(alloc);
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_double_stack_allocator_std_vector_complex)
+    {
+        double_stack<4096> block;
+        Alloc<complex_t, true> alloc(block);
+        std::vector<complex_t, Alloc<complex_t, true>> vec(alloc);
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include "shared/allocation_utility.h"
+#include "shared/reserve_recorder.h"
 #include "shared/test.h"
 
 #include "ktl/ktl_alloc_fwd.h"
 
 #define KTL_DEBUG_ASSERT
+#include "ktl/allocators/cascading.h"
 #include "ktl/allocators/fallback.h"
 #include "ktl/allocators/linear_allocator.h"
 #include "ktl/allocators/mallocator.h"
@@ -114,4 +116,52 @@ namespace ktl::test::fallback_allocator
         type_fallback_allocator<double, linear_allocator<32>, linear_allocator<4096>> alloc;
         assert_unordered_values<double>(alloc);
     }
+
+    KTL_ADD_TEST(test_fallback_cascading_linear_try_deallocate)
+    {
+        fallback<cascading<linear_allocator<64>>, linear_allocator<1024>> alloc;
+        linear_allocator<64> other;
+
+        static_assert(detail::has_try_deallocate_v<decltype(alloc)>);
+
+        void* primary = alloc.allocate(32);
+        void* secondary = alloc.allocate(32);
+        void* fallback = alloc.allocate(128);
+        void* foreign = other.allocate(32);
+
+        KTL_TEST_ASSERT(alloc.owns(primary));
+        KTL_TEST_ASSERT(alloc.owns(fallback));
+        KTL_TEST_ASSERT(!alloc.owns(foreign));
+
+        // Memory that isn't owned should be left alone
+        KTL_TEST_ASSERT(!alloc.try_deallocate(foreign, 32));
+
+        KTL_TEST_ASSERT(alloc.try_deallocate(fallback, 128));
+        KTL_TEST_ASSERT(alloc.try_deallocate(secondary, 32));
+        KTL_TEST_ASSERT(alloc.try_deallocate(primary, 32));
+
+        other.deallocate(foreign, 32);
+    }
+
+    KTL_ADD_TEST(test_fallback_reserve)
+    {
+        size_t primary_reserved = 0;
+        size_t fallback_reserved = 0;
+
+        fallback<reserve_recorder, reserve_recorder> alloc(
+            reserve_recorder(primary_reserved, 64),
+            reserve_recorder(fallback_reserved, 1024));
+
+        // The primary allocator can cover this on its own
+        KTL_TEST_ASSERT(alloc.reserve(64));
+        KTL_TEST_ASSERT(primary_reserved == 64);
+        KTL_TEST_ASSERT(fallback_reserved == 0);
+
+        // The fallback allocator is only asked when the primary allocator can't cover it
+        KTL_TEST_ASSERT(alloc.reserve(256));
+        KTL_TEST_ASSERT(primary_reserved == 320);
+        KTL_TEST_ASSERT(fallback_reserved == 256);
+
+        KTL_TEST_ASSERT(!alloc.reserve(2048));
+    }
 }
\ No newline at end of file
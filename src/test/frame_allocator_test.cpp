@@ -0,0 +1,92 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/frame_allocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <cstring>
+#include <vector>
+
+// Naming scheme: test_frame_allocator_[Type]
+// Contains tests that relate directly to the ktl::frame_allocator
+
+namespace ktl::test::frame_allocator
+{
+    KTL_ADD_TEST(test_frame_raw_allocate)
+    {
+        ktl::frame_allocator<4096> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_frame_allocator_unordered_double)
+    {
+        type_frame_allocator<double, 4096> alloc;
+        assert_unordered_values<double>(alloc);
+    }
+
+    KTL_ADD_TEST(test_frame_allocator_next_frame)
+    {
+        ktl::frame_allocator<1024, 2> alloc;
+
+        // Fill the first frame
+        void* p1 = alloc.allocate(1024);
+        KTL_TEST_ASSERT(p1);
+        KTL_TEST_ASSERT(!alloc.allocate(16));
+
+        std::memset(p1, 0x01, 1024);
+
+        // The second frame should be separate, so the first frame's memory stays untouched
+        alloc.next_frame();
+
+        void* p2 = alloc.allocate(1024);
+        KTL_TEST_ASSERT(p2);
+        KTL_TEST_ASSERT(p2 != p1);
+
+        std::memset(p2, 0x02, 1024);
+
+        KTL_TEST_ASSERT(*static_cast<char*>(p1) == 0x01);
+        KTL_TEST_ASSERT(alloc.owns(p1));
+        KTL_TEST_ASSERT(alloc.owns(p2));
+
+        // The first frame should now be reused
+        alloc.next_frame();
+
+        void* p3 = alloc.allocate(16);
+        KTL_TEST_ASSERT(p3 == p1);
+        KTL_TEST_ASSERT(alloc.frame() == 0);
+    }
+
+    KTL_ADD_TEST(test_frame_allocator_alignment)
+    {
+        // An odd size should still keep every frame aligned
+        ktl::frame_allocator<1000, 3> alloc;
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            void* p = alloc.allocate(8);
+            KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & detail::ALIGNMENT_MASK) == 0);
+
+            alloc.next_frame();
+        }
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_frame_allocator_std_vector_double)
+    {
+        std::vector<double, type_shared_frame_allocator<double, 4096>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_frame_allocator_std_vector_complex)
+    {
+        std::vector<complex_t, type_shared_frame_allocator<complex_t, 4096>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
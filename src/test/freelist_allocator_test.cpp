@@ -40,4 +40,45 @@ namespace ktl::test::freelist_allocator
         type_freelist_allocator<packed_t, 16, 32, linear_allocator<4096>> alloc;
         assert_unordered_values<packed_t>(alloc);
     }
+
+    KTL_ADD_TEST(test_freelist_linear_allocator_trim)
+    {
+        freelist<0, 16, linear_allocator<1024>> alloc;
+
+        void* p1 = alloc.allocate(8);
+        void* p2 = alloc.allocate(8);
+
+        alloc.deallocate(p1, 8);
+        alloc.deallocate(p2, 8);
+
+        // Trimming should give both blocks back, which rewinds the linear allocator
+        alloc.trim();
+
+        void* p3 = alloc.allocate(8);
+
+        KTL_TEST_ASSERT(p3 == p1);
+
+        alloc.deallocate(p3, 8);
+    }
+
+    KTL_ADD_TEST(test_freelist_linear_allocator_reserve)
+    {
+        freelist<0, 16, linear_allocator<64>> alloc;
+
+        // The linear allocator only has room for 4 blocks
+        KTL_TEST_ASSERT(alloc.reserve(64));
+        KTL_TEST_ASSERT(!alloc.reserve(80));
+
+        void* ptrs[4];
+        for (size_t i = 0; i < 4; i++)
+        {
+            ptrs[i] = alloc.allocate(16);
+            KTL_TEST_ASSERT(ptrs[i]);
+        }
+
+        KTL_TEST_ASSERT(!alloc.allocate(16));
+
+        for (size_t i = 0; i < 4; i++)
+            alloc.deallocate(ptrs[i], 16);
+    }
 }
\ No newline at end of file
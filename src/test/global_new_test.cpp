@@ -0,0 +1,89 @@
+#include "shared/assert_utility.h"
+#include "shared/test.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/global_new.h"
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/threaded.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Naming scheme: test_global_new_[Type]
+// Contains tests that relate directly to the ktl::global_new
+
+namespace ktl::test::global_new
+{
+    template<size_t Alignment>
+    void assert_global_new_alignment()
+    {
+        using Alloc = ktl::global_new<ktl::threaded<ktl::linear_allocator<16384>>>;
+
+        void* p = Alloc::allocate(48, Alignment);
+
+        KTL_TEST_ASSERT(p);
+        KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & (Alignment - 1)) == 0);
+        KTL_TEST_ASSERT(Alloc::owns(p));
+
+        std::memset(p, 0xFF, 48);
+
+        Alloc::deallocate(p);
+    }
+
+    KTL_ADD_TEST(test_global_new_alignment)
+    {
+        assert_global_new_alignment<1>();
+        assert_global_new_alignment<16>();
+        assert_global_new_alignment<64>();
+        assert_global_new_alignment<256>();
+        assert_global_new_alignment<4096>();
+    }
+
+    KTL_ADD_TEST(test_global_new_fallback)
+    {
+        using Alloc = ktl::global_new<ktl::linear_allocator<256>>;
+
+        // Fits within the linear allocator
+        void* p1 = Alloc::allocate(128);
+        KTL_TEST_ASSERT(p1);
+        KTL_TEST_ASSERT(Alloc::owns(p1));
+
+        // Too large, so it falls back to malloc
+        void* p2 = Alloc::allocate(1024);
+        KTL_TEST_ASSERT(p2);
+        KTL_TEST_ASSERT(!Alloc::owns(p2));
+
+        std::memset(p2, 0xFF, 1024);
+
+        // Deallocations go back to whichever allocator they came from
+        Alloc::deallocate(p2);
+        Alloc::deallocate(p1);
+        Alloc::deallocate(nullptr);
+
+        // The linear allocator should be empty again
+        void* p3 = Alloc::allocate(128);
+        KTL_TEST_ASSERT(p3 == p1);
+        Alloc::deallocate(p3);
+    }
+
+    KTL_ADD_TEST(test_global_new_throw)
+    {
+        using Alloc = ktl::global_new<ktl::mallocator>;
+
+        bool thrown = false;
+
+        try
+        {
+            Alloc::allocate_or_throw(SIZE_MAX - 8);
+        }
+        catch (const std::bad_alloc&)
+        {
+            thrown = true;
+        }
+
+        KTL_TEST_ASSERT(thrown);
+    }
+}
\ No newline at end of file
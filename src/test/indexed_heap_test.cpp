@@ -0,0 +1,274 @@
+#include "shared/assert_utility.h"
+#include "shared/random.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/containers/indexed_heap.h"
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+// Naming scheme: test_indexed_heap_[Type]
+// Contains tests that relate directly to the ktl::indexed_heap
+
+namespace ktl::test::indexed_heap
+{
+    KTL_ADD_TEST(test_indexed_heap_insert_pop)
+    {
+        constexpr size_t size = 256;
+
+        double values[size];
+        for (size_t i = 0; i < size; i++)
+            values[i] = double(i);
+
+        std::shuffle(values, values + size, random_generator);
+
+        ktl::indexed_min_heap<double> min_heap;
+        ktl::indexed_max_heap<double> max_heap;
+        ktl::indexed_heap<double, std::less<double>, std::allocator<double>, 4> d_ary_heap;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            min_heap.insert(values[i]);
+            max_heap.insert(values[i]);
+            d_ary_heap.insert(values[i]);
+        }
+
+        for (size_t i = 0; i < size; i++)
+        {
+            KTL_TEST_ASSERT(min_heap.pop() == double(i));
+            KTL_TEST_ASSERT(max_heap.pop() == double(size - i - 1));
+            KTL_TEST_ASSERT(d_ary_heap.pop() == double(i));
+        }
+
+        KTL_TEST_ASSERT(min_heap.empty());
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_handles)
+    {
+        ktl::indexed_min_heap<double> heap;
+
+        auto h1 = heap.insert(3.0);
+        auto h2 = heap.insert(1.0);
+        auto h3 = heap.insert(2.0);
+
+        // Handles follow their elements around in the heap
+        KTL_TEST_ASSERT(heap[h1] == 3.0);
+        KTL_TEST_ASSERT(heap[h2] == 1.0);
+        KTL_TEST_ASSERT(heap[h3] == 2.0);
+        KTL_TEST_ASSERT(heap.peek_handle() == h2);
+
+        KTL_TEST_ASSERT(heap.pop() == 1.0);
+
+        // Popping invalidates the handle, but not the others
+        KTL_TEST_ASSERT(!heap.contains(h2));
+        KTL_TEST_ASSERT(heap.get(h2) == nullptr);
+        KTL_TEST_ASSERT(heap[h1] == 3.0);
+        KTL_TEST_ASSERT(heap[h3] == 2.0);
+
+        // The slot is reused, but with a new generation
+        auto h4 = heap.insert(4.0);
+
+        KTL_TEST_ASSERT(h4.Index == h2.Index);
+        KTL_TEST_ASSERT(h4 != h2);
+        KTL_TEST_ASSERT(!heap.contains(h2));
+
+        for (auto iter = heap.begin(); iter != heap.end(); ++iter)
+            KTL_TEST_ASSERT(heap[heap.get_handle(iter)] == *iter);
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_decrease_key)
+    {
+        ktl::indexed_min_heap<trivial_t> heap;
+        std::vector<decltype(heap)::handle> handles;
+
+        for (size_t i = 0; i < 16; i++)
+            handles.push_back(heap.insert({ double(i + 10), 1.0 }));
+
+        heap.decrease_key(handles[12], trivial_t{ 1.0, 1.0 });
+        heap.decrease_key(handles[7], trivial_t{ 4.0, 1.0 });
+
+        KTL_TEST_ASSERT(heap.size() == 16);
+        KTL_TEST_ASSERT(heap.peek_handle() == handles[12]);
+        KTL_TEST_ASSERT(heap.pop() == trivial_t({ 1.0, 1.0 }));
+        KTL_TEST_ASSERT(heap.peek_handle() == handles[7]);
+        KTL_TEST_ASSERT(heap.pop() == trivial_t({ 4.0, 1.0 }));
+        KTL_TEST_ASSERT(heap.pop() == trivial_t({ 10.0, 1.0 }));
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_update_erase)
+    {
+        constexpr size_t size = 64;
+
+        ktl::indexed_min_heap<double> heap;
+        std::vector<decltype(heap)::handle> handles;
+
+        for (size_t i = 0; i < size; i++)
+            handles.push_back(heap.insert(double(i)));
+
+        // Move some elements up and some down
+        heap.update(handles[0], 100.0);
+        heap.update(handles[50], -1.0);
+
+        // Erase elements from the middle of the heap
+        for (size_t i = 1; i < size; i += 2)
+            KTL_TEST_ASSERT(heap.erase(handles[i]));
+
+        KTL_TEST_ASSERT(!heap.erase(handles[1]));
+        KTL_TEST_ASSERT(heap[handles[0]] == 100.0);
+
+        std::vector<double> expected = { -1.0 };
+        for (size_t i = 2; i < size; i += 2)
+        {
+            if (i != 50)
+                expected.push_back(double(i));
+        }
+        expected.push_back(100.0);
+
+        KTL_TEST_ASSERT(heap.size() == expected.size());
+
+        for (double value : expected)
+            KTL_TEST_ASSERT(heap.pop() == value);
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_dijkstra)
+    {
+        // Random weights on a grid, where each node is connected to its 4 neighbours
+        constexpr size_t width = 32;
+        constexpr size_t count = width * width;
+
+        std::vector<double> weights(count);
+        std::uniform_real_distribution<double> distribution(1.0, 10.0);
+        for (size_t i = 0; i < count; i++)
+            weights[i] = distribution(random_generator);
+
+        auto neighbours = [&](size_t node, auto func)
+        {
+            size_t x = node % width;
+            size_t y = node / width;
+
+            if (x > 0) func(node - 1);
+            if (x + 1 < width) func(node + 1);
+            if (y > 0) func(node - width);
+            if (y + 1 < width) func(node + width);
+        };
+
+        typedef std::pair<double, size_t> entry;
+
+        // Reference implementation, which pushes duplicates
+        std::vector<double> expected(count, 1e300);
+        std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+
+        expected[0] = 0.0;
+        queue.push({ 0.0, 0 });
+
+        while (!queue.empty())
+        {
+            auto [cost, node] = queue.top();
+            queue.pop();
+
+            if (cost > expected[node])
+                continue;
+
+            neighbours(node, [&](size_t next)
+            {
+                if (cost + weights[next] < expected[next])
+                {
+                    expected[next] = cost + weights[next];
+                    queue.push({ expected[next], next });
+                }
+            });
+        }
+
+        // Each node is only in the heap once
+        typedef ktl::indexed_min_heap<entry> heap_t;
+
+        std::vector<double> distances(count, 1e300);
+        std::vector<heap_t::handle> handles(count);
+        heap_t heap;
+
+        distances[0] = 0.0;
+        handles[0] = heap.insert({ 0.0, 0 });
+
+        size_t pops = 0;
+        while (!heap.empty())
+        {
+            auto [cost, node] = heap.pop();
+            pops++;
+
+            neighbours(node, [&](size_t next)
+            {
+                if (cost + weights[next] < distances[next])
+                {
+                    distances[next] = cost + weights[next];
+
+                    if (heap.contains(handles[next]))
+                        heap.decrease_key(handles[next], entry{ distances[next], next });
+                    else
+                        handles[next] = heap.insert({ distances[next], next });
+                }
+            });
+        }
+
+        KTL_TEST_ASSERT(pops == count);
+
+        for (size_t i = 0; i < count; i++)
+            KTL_TEST_ASSERT(distances[i] == expected[i]);
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_complex)
+    {
+        ktl::indexed_min_heap<complex_t> heap;
+        std::vector<decltype(heap)::handle> handles;
+
+        for (size_t i = 0; i < 100; i++)
+            handles.push_back(heap.emplace(double(i)));
+
+        for (size_t i = 0; i < 100; i += 3)
+            heap.erase(handles[i]);
+
+        heap.update(handles[98], complex_t(-1.0));
+
+        // Copies should keep the same handles
+        ktl::indexed_min_heap<complex_t> copy = heap;
+
+        KTL_TEST_ASSERT(copy.peek_handle() == handles[98]);
+        KTL_TEST_ASSERT(copy[handles[1]] == complex_t(1.0));
+        KTL_TEST_ASSERT(!copy.contains(handles[0]));
+
+        ktl::indexed_min_heap<complex_t> moved = std::move(copy);
+
+        KTL_TEST_ASSERT(copy.empty());
+        KTL_TEST_ASSERT(moved.size() == heap.size());
+        KTL_TEST_ASSERT(moved.pop() == complex_t(-1.0));
+        KTL_TEST_ASSERT(moved.pop() == complex_t(1.0));
+
+        heap.clear();
+
+        KTL_TEST_ASSERT(heap.empty());
+        KTL_TEST_ASSERT(!heap.contains(handles[1]));
+    }
+
+    KTL_ADD_TEST(test_indexed_heap_linear_allocator)
+    {
+        type_shared_linear_allocator<double, 4096> alloc;
+        ktl::indexed_min_heap<double, type_shared_linear_allocator<double, 4096>> heap(alloc);
+
+        std::vector<decltype(heap)::handle> handles;
+        for (size_t i = 0; i < 32; i++)
+            handles.push_back(heap.insert(double(32 - i)));
+
+        for (size_t i = 0; i < 32; i++)
+            KTL_TEST_ASSERT(heap[handles[i]] == double(32 - i));
+
+        KTL_TEST_ASSERT(heap.pop() == 1.0);
+    }
+}
\ No newline at end of file
@@ -35,6 +35,26 @@ namespace ktl::test::linear_allocator
         assert_unordered_values<packed_t>(alloc);
     }
 
+    KTL_ADD_TEST(test_linear_allocator_expand)
+    {
+        ktl::linear_allocator<4096> alloc;
+
+        void* p1 = alloc.allocate(64);
+        void* p2 = alloc.allocate(64);
+
+        // Only the last allocation can grow in place
+        KTL_TEST_ASSERT(!alloc.expand(p1, 64, 128));
+        KTL_TEST_ASSERT(alloc.expand(p2, 64, 1024));
+        KTL_TEST_ASSERT(!alloc.expand(p2, 1024, 8192));
+
+        void* p3 = alloc.allocate(64);
+        KTL_TEST_ASSERT(static_cast<char*>(p3) == static_cast<char*>(p2) + 1024);
+
+        alloc.deallocate(p3, 64);
+        alloc.deallocate(p2, 1024);
+        alloc.deallocate(p1, 64);
+    }
+
 #pragma region std::vector
     KTL_ADD_TEST(test_linear_allocator_std_vector_double)
     {
@@ -8,6 +8,8 @@
 #define KTL_DEBUG_ASSERT
 #include "ktl/allocators/mallocator.h"
 
+#include <cstdint>
+#include <cstring>
 #include <vector>
 
 // Naming scheme: test_mallocator_[Container]_[Type]
@@ -21,6 +23,22 @@ namespace ktl::test::mallocator
         assert_raw_allocate_deallocate<4, 8, 16, 32, 64, 128>(alloc);
     }
 
+    KTL_ADD_TEST(test_mallocator_aligned_malloc)
+    {
+        // Alignments larger than what malloc guarantees should still be honoured
+        for (size_t alignment = 1; alignment <= 4096; alignment *= 2)
+        {
+            void* p = detail::aligned_malloc(100, alignment);
+
+            KTL_TEST_ASSERT(p);
+            KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & (alignment - 1)) == 0);
+
+            std::memset(p, 0xFF, 100);
+
+            detail::aligned_free(p, 100, alignment);
+        }
+    }
+
     KTL_ADD_TEST(test_mallocator_unordered_double)
     {
         type_mallocator<double> alloc;
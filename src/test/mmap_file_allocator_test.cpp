@@ -0,0 +1,274 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/mmap_file_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/containers/binary_heap.h"
+#include "ktl/containers/indexed_heap.h"
+#include "ktl/containers/trivial_vector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+
+// Naming scheme: test_mmap_file_allocator_[Type]
+// Contains tests that relate directly to the ktl::mmap_file_allocator
+
+namespace ktl::test::mmap_file_allocator
+{
+    constexpr size_t Size = size_t(1) << 20;
+
+    std::string temp_file(const char* name)
+    {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove(path);
+
+        return path.string();
+    }
+
+    KTL_ADD_TEST(test_mmap_file_raw_allocate)
+    {
+        std::string path = temp_file("ktl_mmap_file_raw.bin");
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            ktl::mmap_file_allocator alloc = file.get_allocator();
+            assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_unordered_double)
+    {
+        std::string path = temp_file("ktl_mmap_file_double.bin");
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            type_mmap_file_allocator<double> alloc(file.get_allocator());
+            assert_unordered_values<double>(alloc);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_reuse)
+    {
+        std::string path = temp_file("ktl_mmap_file_reuse.bin");
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            ktl::mmap_file_allocator alloc = file.get_allocator();
+
+            // Memory of the same size class should be reused
+            void* p1 = alloc.allocate(24);
+            alloc.deallocate(p1, 24);
+            void* p2 = alloc.allocate(32);
+
+            KTL_TEST_ASSERT(p1 == p2);
+
+            // Running out of space should fail gracefully
+            KTL_TEST_ASSERT(alloc.allocate(Size) == nullptr);
+
+            alloc.deallocate(p2, 32);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_invalid)
+    {
+        std::string path = temp_file("ktl_mmap_file_invalid.bin");
+
+        {
+            std::ofstream stream(path, std::ios::binary);
+            stream << "This is not a heap";
+        }
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(!file.is_open());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_old_version)
+    {
+        std::string path = temp_file("ktl_mmap_file_old_version.bin");
+
+        {
+            // A heap with the magic of the previous layout, "KTLHEAP1"
+            std::string contents(Size, '\0');
+            uint64_t magic = 0x4B544C4845415031ULL;
+            std::memcpy(contents.data(), &magic, sizeof(magic));
+
+            std::ofstream stream(path, std::ios::binary);
+            stream << contents;
+        }
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(!file.is_open());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_trivial_vector)
+    {
+        typedef ktl::trivial_vector<double, type_mmap_file_allocator<double>> vector_t;
+
+        std::string path = temp_file("ktl_mmap_file_vector.bin");
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            // The vector itself must also live in the file, since its pointers are relative to it
+            type_mmap_file_allocator<double> alloc(file.get_allocator());
+            vector_t* vec = new (file.get_allocator().allocate(sizeof(vector_t))) vector_t(alloc);
+
+            for (size_t i = 0; i < 1000; i++)
+                vec->push_back(double(i));
+
+            file.set_root(vec);
+
+            // Mapping the file a second time places it at a different address
+            ktl::mmap_file other(path.c_str(), Size);
+            KTL_TEST_ASSERT(other.is_open());
+
+            vector_t* mapped = other.get_root<vector_t>();
+            KTL_TEST_ASSERT(mapped != nullptr);
+            KTL_TEST_ASSERT(mapped != vec);
+            KTL_TEST_ASSERT(mapped->size() == 1000);
+
+            for (size_t i = 0; i < 1000; i++)
+                KTL_TEST_ASSERT((*mapped)[i] == double(i));
+        }
+
+        {
+            // Reopening the file should find the vector again and be able to grow it
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            vector_t* vec = file.get_root<vector_t>();
+            KTL_TEST_ASSERT(vec != nullptr);
+            KTL_TEST_ASSERT(vec->size() == 1000);
+
+            for (size_t i = 1000; i < 2000; i++)
+                vec->push_back(double(i));
+
+            for (size_t i = 0; i < 2000; i++)
+                KTL_TEST_ASSERT((*vec)[i] == double(i));
+
+            vec->~vector_t();
+            file.get_allocator().deallocate(vec, sizeof(vector_t));
+            file.set_root(nullptr);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_binary_heap)
+    {
+        typedef ktl::binary_max_heap<int, type_mmap_file_allocator<int>> heap_t;
+
+        std::string path = temp_file("ktl_mmap_file_heap.bin");
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            type_mmap_file_allocator<int> alloc(file.get_allocator());
+            heap_t* heap = new (file.get_allocator().allocate(sizeof(heap_t))) heap_t(alloc);
+
+            int values[] = { 5, 2, 8, 1, 9, 3 };
+            for (int value : values)
+                heap->insert(value);
+
+            file.set_root(heap);
+        }
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            heap_t* heap = file.get_root<heap_t>();
+            KTL_TEST_ASSERT(heap != nullptr);
+
+            int expected[] = { 9, 8, 5, 3, 2, 1 };
+            for (int value : expected)
+                KTL_TEST_ASSERT(heap->pop() == value);
+
+            KTL_TEST_ASSERT(heap->empty());
+
+            heap->~heap_t();
+            file.get_allocator().deallocate(heap, sizeof(heap_t));
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    KTL_ADD_TEST(test_mmap_file_allocator_indexed_heap)
+    {
+        typedef ktl::indexed_min_heap<int, type_mmap_file_allocator<int>> heap_t;
+
+        std::string path = temp_file("ktl_mmap_file_indexed_heap.bin");
+
+        heap_t::handle handle;
+
+        {
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            type_mmap_file_allocator<int> alloc(file.get_allocator());
+            heap_t* heap = new (file.get_allocator().allocate(sizeof(heap_t))) heap_t(alloc);
+
+            int values[] = { 5, 2, 8, 1, 9, 3 };
+            for (int value : values)
+            {
+                heap_t::handle h = heap->insert(value);
+                if (value == 8)
+                    handle = h;
+            }
+
+            file.set_root(heap);
+        }
+
+        {
+            // Handles should stay valid when the file is mapped somewhere else
+            ktl::mmap_file file(path.c_str(), Size);
+            KTL_TEST_ASSERT(file.is_open());
+
+            heap_t* heap = file.get_root<heap_t>();
+            KTL_TEST_ASSERT(heap != nullptr);
+            KTL_TEST_ASSERT((*heap)[handle] == 8);
+
+            heap->decrease_key(handle, 0);
+
+            int expected[] = { 0, 1, 2, 3, 5, 9 };
+            for (int value : expected)
+                KTL_TEST_ASSERT(heap->pop() == value);
+
+            KTL_TEST_ASSERT(heap->empty());
+
+            heap->~heap_t();
+            file.get_allocator().deallocate(heap, sizeof(heap_t));
+        }
+
+        std::filesystem::remove(path);
+    }
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #define KTL_DEBUG_ASSERT
 #include "ktl/allocators/cascading.h"
 #include "ktl/allocators/debug.h"
+#include "ktl/allocators/deferred.h"
 #include "ktl/allocators/fallback.h"
 #include "ktl/allocators/freelist.h"
 #include "ktl/allocators/global.h"
@@ -14,7 +15,9 @@
 #include "ktl/allocators/overflow.h"
 #include "ktl/allocators/reference.h"
 #include "ktl/allocators/segragator.h"
+#include "ktl/allocators/sharded.h"
 #include "ktl/allocators/shared.h"
+#include "ktl/allocators/size_header.h"
 #include "ktl/allocators/threaded.h"
 
 #include <sstream>
@@ -62,6 +65,13 @@ namespace ktl::test::nothrow_allocator
 		{
 			return p == nullptr;
 		}
+
+		void trim() {}
+
+		bool reserve(size_t n)
+		{
+			return false;
+		}
     };
 
 	template<typename Alloc, bool NoThrow>
@@ -82,6 +92,14 @@ namespace ktl::test::nothrow_allocator
 			static_assert(detail::has_nothrow_max_size_v<Alloc> == NoThrow);
 		if constexpr (detail::has_owns_v<Alloc>)
 			static_assert(detail::has_nothrow_owns_v<Alloc> == NoThrow);
+		if constexpr (detail::has_try_deallocate_v<Alloc>)
+			static_assert(detail::has_nothrow_try_deallocate_v<Alloc> == NoThrow);
+		if constexpr (detail::has_try_deallocate_v<Alloc> || detail::has_owns_v<Alloc>)
+			static_assert(noexcept(detail::try_deallocate(std::declval<Alloc&>(), nullptr, 0)) == NoThrow);
+		if constexpr (detail::has_trim_v<Alloc>)
+			static_assert(detail::has_nothrow_trim_v<Alloc> == NoThrow);
+		if constexpr (detail::has_reserve_v<Alloc>)
+			static_assert(detail::has_nothrow_reserve_v<Alloc> == NoThrow);
 	}
 
 	KTL_ADD_TEST(test_nothrow_allocator)
@@ -97,17 +115,22 @@ namespace ktl::test::nothrow_allocator
 		test_allocator_nothrow<null_allocator, true>();
 		test_allocator_nothrow<cascading<null_allocator>, true>();
 		test_allocator_nothrow<debug<null_allocator, std::vector<debug_info>>, true>();
+		test_allocator_nothrow<deferred<null_allocator>, true>();
+		test_allocator_nothrow<size_header<null_allocator>, true>();
 		test_allocator_nothrow<fallback<null_allocator, null_allocator>, true>();
 		test_allocator_nothrow<global<null_allocator>, true>();
 		test_allocator_nothrow<overflow<null_allocator>, true>();
 		test_allocator_nothrow<reference<null_allocator>, true>();
 		test_allocator_nothrow<segragator<16, null_allocator, null_allocator>, true>();
+		test_allocator_nothrow<sharded<null_allocator>, true>();
 		test_allocator_nothrow<shared<null_allocator>, true>();
 		test_allocator_nothrow<threaded<null_allocator>, true>();
 
 		// Throwing
 		test_allocator_nothrow<throwing_allocator, false>();
 		test_allocator_nothrow<debug<null_allocator, std::vector<debug_info>>, true>();
+		test_allocator_nothrow<deferred<throwing_allocator>, false>();
+		test_allocator_nothrow<size_header<throwing_allocator>, false>();
 		test_allocator_nothrow<fallback<throwing_allocator, throwing_allocator>, false>();
 		test_allocator_nothrow<overflow<throwing_allocator>, false>();
 		test_allocator_nothrow<segragator<16, throwing_allocator, throwing_allocator>, false>();
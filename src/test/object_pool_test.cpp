@@ -0,0 +1,205 @@
+#include "shared/assert_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/containers/object_pool.h"
+
+#include <cstdint>
+#include <vector>
+
+// Naming scheme: test_object_pool_[Type]
+// Contains tests that relate directly to the ktl::object_pool
+
+namespace ktl::test::object_pool
+{
+    struct counted_t
+    {
+        inline static size_t Constructed = 0;
+        inline static size_t Destroyed = 0;
+        inline static size_t Resets = 0;
+
+        size_t Value;
+        std::vector<int> Buffer;
+
+        counted_t(size_t value = 0) : Value(value) { Constructed++; }
+
+        ~counted_t() { Destroyed++; }
+
+        static void clear_counters()
+        {
+            Constructed = 0;
+            Destroyed = 0;
+            Resets = 0;
+        }
+    };
+
+    struct counted_reset
+    {
+        void operator()(counted_t& value) const
+        {
+            counted_t::Resets++;
+            value.Buffer.clear();
+        }
+    };
+
+    KTL_ADD_TEST(test_object_pool_acquire_release)
+    {
+        counted_t::clear_counters();
+
+        {
+            ktl::object_pool<counted_t> pool;
+
+            counted_t* objects[100];
+            for (size_t i = 0; i < 100; i++)
+                objects[i] = pool.acquire(i);
+
+            KTL_TEST_ASSERT(pool.size() == 100);
+            KTL_TEST_ASSERT(pool.capacity() >= 100);
+
+            for (size_t i = 0; i < 100; i++)
+                KTL_TEST_ASSERT(objects[i]->Value == i);
+
+            for (size_t i = 0; i < 50; i++)
+                pool.release(objects[i]);
+
+            KTL_TEST_ASSERT(pool.size() == 50);
+            KTL_TEST_ASSERT(counted_t::Destroyed == 50);
+
+            // Released slots should be reused before allocating more
+            size_t capacity = pool.capacity();
+            for (size_t i = 0; i < 50; i++)
+                objects[i] = pool.acquire(i + 100);
+
+            KTL_TEST_ASSERT(pool.capacity() == capacity);
+            KTL_TEST_ASSERT(counted_t::Constructed == 150);
+        }
+
+        // Destroying the pool should destroy any objects left
+        KTL_TEST_ASSERT(counted_t::Destroyed == 150);
+    }
+
+    KTL_ADD_TEST(test_object_pool_reset)
+    {
+        counted_t::clear_counters();
+
+        {
+            ktl::object_pool<counted_t, std::allocator<counted_t>, counted_reset> pool;
+
+            counted_t* p1 = pool.acquire(42);
+            p1->Buffer.push_back(1);
+
+            pool.release(p1);
+
+            // The object should be kept alive and untouched while in the pool
+            KTL_TEST_ASSERT(counted_t::Destroyed == 0);
+            KTL_TEST_ASSERT(p1->Value == 42);
+            KTL_TEST_ASSERT(p1->Buffer.capacity() > 0);
+
+            // Acquiring it again should reset it, rather than construct it
+            counted_t* p2 = pool.acquire(58);
+
+            KTL_TEST_ASSERT(p2 == p1);
+            KTL_TEST_ASSERT(p2->Value == 42);
+            KTL_TEST_ASSERT(p2->Buffer.empty());
+            KTL_TEST_ASSERT(counted_t::Constructed == 1);
+            KTL_TEST_ASSERT(counted_t::Resets == 1);
+        }
+
+        KTL_TEST_ASSERT(counted_t::Destroyed == 1);
+    }
+
+    KTL_ADD_TEST(test_object_pool_clear)
+    {
+        counted_t::clear_counters();
+
+        {
+            ktl::object_pool<counted_t, std::allocator<counted_t>, counted_reset, 16> pool;
+
+            for (size_t i = 0; i < 100; i++)
+                pool.acquire(i);
+
+            size_t capacity = pool.capacity();
+
+            pool.clear();
+
+            KTL_TEST_ASSERT(pool.empty());
+
+            // Everything should be recycled, without constructing or allocating anything
+            for (size_t i = 0; i < 100; i++)
+                pool.acquire(i);
+
+            KTL_TEST_ASSERT(pool.size() == 100);
+            KTL_TEST_ASSERT(pool.capacity() == capacity);
+            KTL_TEST_ASSERT(counted_t::Constructed == 100);
+            KTL_TEST_ASSERT(counted_t::Resets == 100);
+            KTL_TEST_ASSERT(counted_t::Destroyed == 0);
+
+            // Going past the old watermark should construct new objects again
+            pool.acquire(100);
+
+            KTL_TEST_ASSERT(counted_t::Constructed == 101);
+        }
+
+        KTL_TEST_ASSERT(counted_t::Destroyed == 101);
+    }
+
+    KTL_ADD_TEST(test_object_pool_clear_destroy)
+    {
+        counted_t::clear_counters();
+
+        ktl::object_pool<counted_t, std::allocator<counted_t>, void, 16> pool;
+
+        counted_t* objects[40];
+        for (size_t i = 0; i < 40; i++)
+            objects[i] = pool.acquire(i);
+
+        for (size_t i = 0; i < 40; i += 2)
+            pool.release(objects[i]);
+
+        // Without a reset hook, only the live objects should be destroyed
+        pool.clear();
+
+        KTL_TEST_ASSERT(counted_t::Destroyed == 40);
+        KTL_TEST_ASSERT(pool.empty());
+    }
+
+    KTL_ADD_TEST(test_object_pool_alignment)
+    {
+        ktl::object_pool<double, type_allocator<double, mallocator>, void, 8> pool;
+
+        // The first object in every slab should be aligned to a cache line
+        for (size_t i = 0; i < 64; i++)
+        {
+            double* p = pool.acquire(double(i));
+
+            if (i % 8 == 0)
+                KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & 63) == 0);
+        }
+
+        pool.clear();
+
+        KTL_TEST_ASSERT(pool.empty());
+    }
+
+    KTL_ADD_TEST(test_object_pool_move)
+    {
+        ktl::object_pool<complex_t> pool1;
+
+        complex_t* p = pool1.acquire(42.0);
+
+        ktl::object_pool<complex_t> pool2(std::move(pool1));
+
+        KTL_TEST_ASSERT(pool1.empty());
+        KTL_TEST_ASSERT(pool2.size() == 1);
+
+        pool2.release(p);
+
+        KTL_TEST_ASSERT(pool2.empty());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "shared/assert_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/containers/offset_ptr.h"
+
+#include <cstring>
+
+// Naming scheme: offset_ptr
+// Contains tests that use the ktl::offset_ptr
+
+namespace ktl::test::offset_ptr
+{
+    struct node
+    {
+        ktl::offset_ptr<node> Next;
+        int Value;
+    };
+
+    KTL_ADD_TEST(test_offset_ptr_null)
+    {
+        ktl::offset_ptr<int> ptr;
+
+        KTL_TEST_ASSERT(ptr == nullptr);
+        KTL_TEST_ASSERT(!ptr);
+
+        int value = 42;
+        ptr = &value;
+
+        KTL_TEST_ASSERT(ptr);
+        KTL_TEST_ASSERT(*ptr == 42);
+
+        ptr = nullptr;
+
+        KTL_TEST_ASSERT(ptr.get() == nullptr);
+    }
+
+    KTL_ADD_TEST(test_offset_ptr_copy)
+    {
+        int value = 42;
+
+        ktl::offset_ptr<int> ptr1 = &value;
+        ktl::offset_ptr<int> ptr2 = ptr1;
+        ktl::offset_ptr<const int> ptr3 = ptr2;
+
+        // The copies are at different addresses, but should point to the same value
+        KTL_TEST_ASSERT(ptr1 == &value);
+        KTL_TEST_ASSERT(ptr2 == &value);
+        KTL_TEST_ASSERT(ptr3 == &value);
+    }
+
+    KTL_ADD_TEST(test_offset_ptr_arithmetic)
+    {
+        int values[] = { 1, 2, 3, 4 };
+
+        ktl::offset_ptr<int> ptr = values;
+
+        KTL_TEST_ASSERT(*ptr++ == 1);
+        KTL_TEST_ASSERT(*ptr == 2);
+        KTL_TEST_ASSERT(*++ptr == 3);
+
+        ptr += 1;
+
+        KTL_TEST_ASSERT(*ptr == 4);
+        KTL_TEST_ASSERT(ptr - values == 3);
+        KTL_TEST_ASSERT(ptr[-3] == 1);
+
+        ptr -= 2;
+
+        KTL_TEST_ASSERT(*ptr-- == 2);
+        KTL_TEST_ASSERT(*ptr == 1);
+    }
+
+    KTL_ADD_TEST(test_offset_ptr_relocate)
+    {
+        node src[2];
+        src[0].Next = &src[1];
+        src[0].Value = 1;
+        src[1].Next = nullptr;
+        src[1].Value = 2;
+
+        // Moving the memory as a whole should keep the pointers inside it valid
+        node dst[2];
+        std::memcpy(static_cast<void*>(dst), src, sizeof(src));
+
+        KTL_TEST_ASSERT(dst[0].Next == &dst[1]);
+        KTL_TEST_ASSERT(dst[0].Next->Value == 2);
+        KTL_TEST_ASSERT(dst[1].Next == nullptr);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "shared/allocation_utility.h"
+#include "shared/assert_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/freelist.h"
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/pmr_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+// Naming scheme: test_pmr_[Type]
+// Contains tests that relate directly to the ktl::pmr_allocator and ktl::pmr_resource
+
+namespace ktl::test::pmr_allocator
+{
+#pragma region pmr_allocator
+    KTL_ADD_TEST(test_pmr_allocator_raw_allocate)
+    {
+        std::pmr::unsynchronized_pool_resource resource;
+        ktl::pmr_allocator alloc(&resource);
+
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_pmr_allocator_equality)
+    {
+        std::pmr::monotonic_buffer_resource resource1;
+        std::pmr::monotonic_buffer_resource resource2;
+
+        ktl::pmr_allocator alloc1(&resource1);
+        ktl::pmr_allocator alloc2(&resource1);
+        ktl::pmr_allocator alloc3(&resource2);
+
+        KTL_TEST_ASSERT(alloc1 == alloc2);
+        KTL_TEST_ASSERT(alloc1 != alloc3);
+    }
+
+    KTL_ADD_TEST(test_pmr_allocator_null)
+    {
+        // A monotonic buffer backed by the null resource can run out
+        char buffer[256];
+        std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+        ktl::pmr_allocator alloc(&resource);
+
+        void* p = alloc.allocate(1024);
+
+        KTL_TEST_ASSERT(!p);
+    }
+
+    KTL_ADD_TEST(test_pmr_allocator_std_vector_double)
+    {
+        std::pmr::unsynchronized_pool_resource resource;
+        type_pmr_allocator<double> alloc(&resource);
+        std::vector<double, type_pmr_allocator<double>> vec(alloc);
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_pmr_allocator_std_vector_complex)
+    {
+        std::pmr::unsynchronized_pool_resource resource;
+        type_pmr_allocator<complex_t> alloc(&resource);
+        std::vector<complex_t, type_pmr_allocator<complex_t>> vec(alloc);
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+
+#pragma region pmr_resource
+    KTL_ADD_TEST(test_pmr_resource_alignment)
+    {
+        ktl::pmr_resource<ktl::linear_allocator<4096>> resource;
+
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* p = resource.allocate(24, alignment);
+
+            KTL_TEST_ASSERT(p);
+            KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p) & (alignment - 1)) == 0);
+
+            resource.deallocate(p, 24, alignment);
+        }
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_bad_alloc)
+    {
+        ktl::pmr_resource<ktl::linear_allocator<256>> resource;
+
+        bool thrown = false;
+
+        try
+        {
+            void* p = resource.allocate(1024);
+            resource.deallocate(p, 1024);
+        }
+        catch (const std::bad_alloc&)
+        {
+            thrown = true;
+        }
+
+        KTL_TEST_ASSERT(thrown);
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_equality)
+    {
+        ktl::pmr_resource<ktl::mallocator> resource1;
+        ktl::pmr_resource<ktl::mallocator> resource2;
+        ktl::pmr_resource<ktl::linear_allocator<256>> resource3;
+        ktl::pmr_resource<ktl::linear_allocator<256>> resource4;
+
+        KTL_TEST_ASSERT(resource1.is_equal(resource2));
+        KTL_TEST_ASSERT(!resource1.is_equal(resource3));
+        KTL_TEST_ASSERT(resource3.is_equal(resource3));
+        KTL_TEST_ASSERT(!resource3.is_equal(resource4));
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_pmr_vector_double)
+    {
+        ktl::pmr_resource<ktl::linear_allocator<4096>> resource;
+        std::pmr::vector<double> vec(&resource);
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_pmr_vector_complex)
+    {
+        ktl::pmr_resource<ktl::freelist<0, 64, ktl::mallocator>> resource;
+        std::pmr::vector<complex_t> vec(&resource);
+        assert_vector_values<complex_t>(vec);
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_pmr_unordered_map)
+    {
+        ktl::pmr_resource<ktl::mallocator> resource;
+        std::pmr::unordered_map<int, double> map(&resource);
+
+        for (int i = 0; i < 128; i++)
+            map[i] = i * 0.5;
+
+        for (int i = 0; i < 128; i++)
+            KTL_TEST_ASSERT(map[i] == i * 0.5);
+
+        map.clear();
+
+        KTL_TEST_ASSERT(map.empty());
+    }
+
+    KTL_ADD_TEST(test_pmr_resource_round_trip)
+    {
+        // A KTL allocator, seen as a memory resource, seen as a KTL allocator again
+        ktl::pmr_resource<ktl::mallocator> resource;
+        ktl::pmr_allocator alloc(&resource);
+
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/ring_allocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <cstring>
+#include <vector>
+
+// Naming scheme: test_ring_allocator_[Type]
+// Contains tests that relate directly to the ktl::ring_allocator
+
+namespace ktl::test::ring_allocator
+{
+    KTL_ADD_TEST(test_ring_raw_allocate)
+    {
+        ktl::ring_allocator<4096> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_unordered_double)
+    {
+        type_ring_allocator<double, 4096> alloc;
+        assert_unordered_values<double>(alloc);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_unordered_packed)
+    {
+        type_ring_allocator<packed_t, 4096> alloc;
+        assert_unordered_values<packed_t>(alloc);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_streaming)
+    {
+        ktl::ring_allocator<1024> alloc;
+
+        // Keep a window of allocations alive, freeing the oldest one every time, which should wrap around many times
+        constexpr size_t Window = 4;
+        void* window[Window] = {};
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t slot = i % Window;
+            if (window[slot])
+            {
+                KTL_TEST_ASSERT(*static_cast<size_t*>(window[slot]) == i - Window);
+                alloc.deallocate(window[slot], 100);
+            }
+
+            window[slot] = alloc.allocate(100);
+            KTL_TEST_ASSERT(window[slot] != nullptr);
+
+            *static_cast<size_t*>(window[slot]) = i;
+        }
+
+        for (size_t i = 0; i < Window; i++)
+            alloc.deallocate(window[i], 100);
+
+        KTL_TEST_ASSERT(alloc.used() == 0);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_out_of_order)
+    {
+        ktl::ring_allocator<1024> alloc;
+
+        void* p1 = alloc.allocate(200);
+        void* p2 = alloc.allocate(200);
+        void* p3 = alloc.allocate(200);
+
+        size_t used = alloc.used();
+
+        // Freeing a newer allocation first shouldn't reclaim anything
+        alloc.deallocate(p2, 200);
+        KTL_TEST_ASSERT(alloc.used() == used);
+
+        // Until the oldest one is freed as well
+        alloc.deallocate(p1, 200);
+        KTL_TEST_ASSERT(alloc.used() < used);
+
+        // There should now be room to wrap around
+        void* p4 = alloc.allocate(400);
+        KTL_TEST_ASSERT(p4 != nullptr);
+        KTL_TEST_ASSERT(p4 < p3);
+
+        // But not to overwrite p3
+        KTL_TEST_ASSERT(alloc.allocate(300) == nullptr);
+
+        alloc.deallocate(p3, 200);
+        alloc.deallocate(p4, 400);
+
+        KTL_TEST_ASSERT(alloc.used() == 0);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_expand)
+    {
+        ktl::ring_allocator<4096> alloc;
+
+        void* p1 = alloc.allocate(64);
+        void* p2 = alloc.allocate(64);
+
+        // Only the last allocation can grow in place
+        KTL_TEST_ASSERT(!alloc.expand(p1, 64, 128));
+        KTL_TEST_ASSERT(alloc.expand(p2, 64, 1024));
+        KTL_TEST_ASSERT(!alloc.expand(p2, 1024, 8192));
+
+        alloc.deallocate(p1, 64);
+        alloc.deallocate(p2, 1024);
+
+        KTL_TEST_ASSERT(alloc.used() == 0);
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_ring_allocator_std_vector_double)
+    {
+        std::vector<double, type_shared_ring_allocator<double, 4096>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_ring_allocator_std_vector_complex)
+    {
+        std::vector<complex_t, type_shared_ring_allocator<complex_t, 4096>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include "shared/allocation_utility.h"
+#include "shared/counting_allocator.h"
+#include "shared/reserve_recorder.h"
 #include "shared/test.h"
 
 #include "ktl/ktl_alloc_fwd.h"
 
 #define KTL_DEBUG_ASSERT
+#include "ktl/allocators/freelist.h"
 #include "ktl/allocators/linear_allocator.h"
 #include "ktl/allocators/mallocator.h"
 #include "ktl/allocators/segragator.h"
@@ -114,4 +117,106 @@ namespace ktl::test::segragator_allocator
         AllocTrivial trivial_alloc = static_cast<AllocTrivial>(double_alloc);
         assert_unordered_values<trivial_t>(trivial_alloc);
     }
+
+    class constructing_allocator
+    {
+    public:
+        explicit constructing_allocator(size_t& constructions) noexcept :
+            m_Constructions(&constructions) {}
+
+        bool operator==(const constructing_allocator& rhs) const noexcept
+        {
+            return m_Constructions == rhs.m_Constructions;
+        }
+
+        bool operator!=(const constructing_allocator& rhs) const noexcept
+        {
+            return m_Constructions != rhs.m_Constructions;
+        }
+
+        void* allocate(size_t n) noexcept
+        {
+            return m_Alloc.allocate(n);
+        }
+
+        void deallocate(void* p, size_t n) noexcept
+        {
+            m_Alloc.deallocate(p, n);
+        }
+
+        template<typename T, typename... Args>
+        void construct(T* p, Args&&... args)
+        {
+            (*m_Constructions)++;
+            ::new(p) T(std::forward<Args>(args)...);
+        }
+
+    private:
+        mallocator m_Alloc;
+        size_t* m_Constructions;
+    };
+
+    KTL_ADD_TEST(test_segragator_malloc_static_construct)
+    {
+        size_t constructions = 0;
+
+        // The primary allocator has no owns(), but objects bigger than the threshold can only come from the fallback
+        segragator<8, mallocator, constructing_allocator> alloc(std::forward_as_tuple(), std::forward_as_tuple(constructions));
+
+        trivial_t* p = static_cast<trivial_t*>(alloc.allocate(sizeof(trivial_t)));
+
+        alloc.construct(p);
+
+        KTL_TEST_ASSERT(constructions == 1);
+
+        alloc.deallocate(p, sizeof(trivial_t));
+    }
+
+    KTL_ADD_TEST(test_segragator_reserve)
+    {
+        size_t primary_reserved = 0;
+        size_t fallback_reserved = 0;
+
+        segragator<64, reserve_recorder, reserve_recorder> alloc(
+            reserve_recorder(primary_reserved, 1024),
+            reserve_recorder(fallback_reserved, 4096));
+
+        // The byte budget should be passed on to both allocators, regardless of the threshold
+        KTL_TEST_ASSERT(alloc.reserve(32));
+        KTL_TEST_ASSERT(primary_reserved == 32);
+        KTL_TEST_ASSERT(fallback_reserved == 32);
+
+        KTL_TEST_ASSERT(alloc.reserve(1024));
+        KTL_TEST_ASSERT(primary_reserved == 1056);
+        KTL_TEST_ASSERT(fallback_reserved == 1056);
+
+        // Fails if either allocator fails
+        KTL_TEST_ASSERT(!alloc.reserve(2048));
+        KTL_TEST_ASSERT(fallback_reserved == 3104);
+    }
+
+    KTL_ADD_TEST(test_segragator_freelist_reserve)
+    {
+        constexpr size_t blocks = 100;
+
+        shared<counting_allocator<mallocator>> upstream;
+        segragator<64, freelist<0, 64, shared<counting_allocator<mallocator>>>, mallocator> alloc(upstream);
+
+        // Warming the freelist should allocate every block up front
+        KTL_TEST_ASSERT(alloc.reserve(blocks * 64));
+        KTL_TEST_ASSERT(upstream.get_allocator().allocations() == blocks);
+
+        void* ptrs[blocks];
+        for (size_t i = 0; i < blocks; i++)
+        {
+            ptrs[i] = alloc.allocate(i % 64 + 1);
+            KTL_TEST_ASSERT(ptrs[i]);
+        }
+
+        // None of the allocations should have reached the upstream allocator
+        KTL_TEST_ASSERT(upstream.get_allocator().allocations() == blocks);
+
+        for (size_t i = 0; i < blocks; i++)
+            alloc.deallocate(ptrs[i], i % 64 + 1);
+    }
 }
\ No newline at end of file
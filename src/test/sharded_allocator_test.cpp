@@ -0,0 +1,126 @@
+#include "shared/allocation_utility.h"
+#include "shared/reserve_recorder.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/freelist.h"
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/sharded.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Naming scheme: test_sharded_[Alloc]_[Type]
+// Contains tests that relate directly to the ktl::sharded
+
+namespace ktl::test::sharded_allocator
+{
+    KTL_ADD_TEST(test_sharded_freelist_raw_allocate)
+    {
+        ktl::sharded<ktl::freelist<0, 64, ktl::mallocator>, 4> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_sharded_linear_raw_allocate)
+    {
+        ktl::sharded<ktl::linear_allocator<1024>, 4> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_sharded_linear_spill)
+    {
+        ktl::sharded<ktl::linear_allocator<64>, 4> alloc;
+
+        // Once the current shard is full, the other shards should be used
+        void* ptrs[4];
+        for (size_t i = 0; i < 4; i++)
+        {
+            ptrs[i] = alloc.allocate(64);
+            KTL_TEST_ASSERT(ptrs[i]);
+            KTL_TEST_ASSERT(alloc.owns(ptrs[i]));
+        }
+
+        KTL_TEST_ASSERT(!alloc.allocate(64));
+
+        // Each allocation should be returned to the shard it came from
+        for (size_t i = 0; i < 4; i++)
+            alloc.deallocate(ptrs[i], 64);
+
+        void* p = alloc.allocate(64);
+        KTL_TEST_ASSERT(p);
+        alloc.deallocate(p, 64);
+    }
+
+    KTL_ADD_TEST(test_sharded_forwarding_constructor)
+    {
+        size_t reserved = 0;
+
+        // Every shard should be constructed from the same arguments
+        ktl::sharded<reserve_recorder, 4> alloc(reserved, 64);
+
+        KTL_TEST_ASSERT(alloc.reserve(16));
+        KTL_TEST_ASSERT(reserved == 64);
+
+        KTL_TEST_ASSERT(!alloc.reserve(128));
+    }
+
+    KTL_ADD_TEST(test_sharded_linear_threaded)
+    {
+        constexpr size_t threads = 4;
+
+        ktl::sharded<ktl::linear_allocator<4096>, threads> alloc;
+        std::atomic<bool> corrupted(false);
+
+        auto worker = [&](size_t id)
+        {
+            for (size_t i = 0; i < 10000; i++)
+            {
+                size_t* p = static_cast<size_t*>(alloc.allocate(sizeof(size_t)));
+                if (!p)
+                    continue;
+
+                *p = id;
+
+                // Yield to increase the chance of being migrated to another CPU
+                if (i % 100 == 0)
+                    std::this_thread::yield();
+
+                if (*p != id)
+                    corrupted.store(true);
+
+                alloc.deallocate(p, sizeof(size_t));
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < threads; i++)
+            workers.emplace_back(worker, i);
+
+        for (auto& thread : workers)
+            thread.join();
+
+        KTL_TEST_ASSERT(!corrupted.load());
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_sharded_freelist_std_vector_double)
+    {
+        std::vector<double, type_shared_sharded<double, ktl::freelist<0, 64, ktl::mallocator>, 4>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_sharded_mallocator_std_vector_complex)
+    {
+        std::vector<complex_t, type_shared_sharded<complex_t, ktl::mallocator, 4>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/shm_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/containers/trivial_vector.h"
+
+#include <new>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Naming scheme: test_shm_allocator_[Type]
+// Contains tests that relate directly to the ktl::shm_segment and ktl::shm_allocator
+
+namespace ktl::test::shm_allocator
+{
+    constexpr size_t Size = size_t(1) << 20;
+
+    std::string segment_name(const char* name)
+    {
+#if defined(_WIN32)
+        std::string segment = std::string("Local\\") + name;
+#else
+        std::string segment = std::string("/") + name + "_" + std::to_string(getpid());
+#endif
+
+        ktl::shm_segment::remove(segment.c_str());
+
+        return segment;
+    }
+
+    KTL_ADD_TEST(test_shm_raw_allocate)
+    {
+        std::string name = segment_name("ktl_shm_raw");
+
+        {
+            ktl::shm_segment segment(name.c_str(), Size);
+            KTL_TEST_ASSERT(segment.is_open());
+
+            ktl::shm_allocator alloc = segment.get_allocator();
+            assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+        }
+
+        ktl::shm_segment::remove(name.c_str());
+    }
+
+    KTL_ADD_TEST(test_shm_allocator_unordered_double)
+    {
+        std::string name = segment_name("ktl_shm_double");
+
+        {
+            ktl::shm_segment segment(name.c_str(), Size);
+            KTL_TEST_ASSERT(segment.is_open());
+
+            type_shm_allocator<double> alloc(segment.get_allocator());
+            assert_unordered_values<double>(alloc);
+        }
+
+        ktl::shm_segment::remove(name.c_str());
+    }
+
+    KTL_ADD_TEST(test_shm_allocator_named_roots)
+    {
+        std::string name = segment_name("ktl_shm_roots");
+
+        {
+            ktl::shm_segment segment(name.c_str(), Size);
+            KTL_TEST_ASSERT(segment.is_open());
+
+            ktl::shm_allocator alloc = segment.get_allocator();
+
+            int* values[16];
+            for (int i = 0; i < 16; i++)
+            {
+                values[i] = static_cast<int*>(alloc.allocate(sizeof(int)));
+                *values[i] = i;
+
+                std::string root = "root" + std::to_string(i);
+                KTL_TEST_ASSERT(segment.set_root(root.c_str(), values[i]));
+            }
+
+            // The table is full and names must fit
+            KTL_TEST_ASSERT(!segment.set_root("another", values[0]));
+            KTL_TEST_ASSERT(!segment.set_root("a name which is far too long to fit", values[0]));
+
+            // Mapping the segment again should find the same roots, at a different address
+            ktl::shm_segment other(name.c_str(), Size);
+            KTL_TEST_ASSERT(other.is_open());
+
+            for (int i = 0; i < 16; i++)
+            {
+                std::string root = "root" + std::to_string(i);
+                int* value = other.get_root<int>(root.c_str());
+
+                KTL_TEST_ASSERT(value != nullptr);
+                KTL_TEST_ASSERT(value != values[i]);
+                KTL_TEST_ASSERT(*value == i);
+            }
+
+            // Removing a root frees up its slot
+            KTL_TEST_ASSERT(segment.set_root("root3", nullptr));
+            KTL_TEST_ASSERT(other.get_root<int>("root3") == nullptr);
+            KTL_TEST_ASSERT(segment.set_root("another", values[3]));
+            KTL_TEST_ASSERT(*other.get_root<int>("another") == 3);
+
+            for (int i = 0; i < 16; i++)
+                alloc.deallocate(values[i], sizeof(int));
+        }
+
+        ktl::shm_segment::remove(name.c_str());
+    }
+
+#if !defined(_WIN32)
+    KTL_ADD_TEST(test_shm_allocator_process)
+    {
+        typedef ktl::trivial_vector<int, type_shm_allocator<int>> vector_t;
+
+        std::string name = segment_name("ktl_shm_process");
+
+        ktl::shm_segment segment(name.c_str(), Size);
+        KTL_TEST_ASSERT(segment.is_open());
+
+        type_shm_allocator<int> alloc(segment.get_allocator());
+        vector_t* vec = new (segment.get_allocator().allocate(sizeof(vector_t))) vector_t(alloc);
+
+        for (int i = 0; i < 100; i++)
+            vec->push_back(i);
+
+        KTL_TEST_ASSERT(segment.set_root("numbers", vec));
+
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            // The child maps the segment by name and finds the vector through its root
+            ktl::shm_segment child(name.c_str(), Size);
+            if (!child.is_open())
+                _exit(1);
+
+            vector_t* numbers = child.get_root<vector_t>("numbers");
+            if (!numbers || numbers->size() != 100)
+                _exit(2);
+
+            for (int i = 0; i < 100; i++)
+            {
+                if ((*numbers)[i] != i)
+                    _exit(3);
+            }
+
+            // Allocate while the parent is doing the same, to contend on the lock
+            ktl::shm_allocator child_alloc = child.get_allocator();
+            for (int i = 0; i < 10000; i++)
+            {
+                int* p = static_cast<int*>(child_alloc.allocate(sizeof(int) * 4));
+                if (!p)
+                    _exit(4);
+
+                p[0] = p[3] = -i;
+                if (p[0] != -i || p[3] != -i)
+                    _exit(5);
+
+                child_alloc.deallocate(p, sizeof(int) * 4);
+            }
+
+            for (int i = 100; i < 200; i++)
+                numbers->push_back(i);
+
+            _exit(0);
+        }
+
+        KTL_TEST_ASSERT(pid > 0);
+
+        ktl::shm_allocator parent_alloc = segment.get_allocator();
+        for (int i = 0; i < 10000; i++)
+        {
+            int* p = static_cast<int*>(parent_alloc.allocate(sizeof(int) * 4));
+            KTL_TEST_ASSERT(p != nullptr);
+
+            p[0] = p[3] = i;
+            KTL_TEST_ASSERT(p[0] == i && p[3] == i);
+
+            parent_alloc.deallocate(p, sizeof(int) * 4);
+        }
+
+        int status = 0;
+        KTL_TEST_ASSERT(waitpid(pid, &status, 0) == pid);
+        KTL_TEST_ASSERT(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+        // The values pushed by the child should be visible here
+        KTL_TEST_ASSERT(vec->size() == 200);
+
+        for (int i = 0; i < 200; i++)
+            KTL_TEST_ASSERT((*vec)[i] == i);
+
+        vec->~vector_t();
+        segment.get_allocator().deallocate(vec, sizeof(vector_t));
+
+        ktl::shm_segment::remove(name.c_str());
+    }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "shared/allocation_utility.h"
+#include "shared/counting_allocator.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/freelist.h"
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/segragator.h"
+#include "ktl/allocators/size_header.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <vector>
+
+// Naming scheme: test_size_header_[Type]
+// Contains tests that relate directly to the ktl::size_header
+
+namespace ktl::test::size_header
+{
+    KTL_ADD_TEST(test_size_header_raw_allocate)
+    {
+        ktl::size_header<ktl::mallocator> alloc;
+        assert_raw_allocate_deallocate<1, 8, 32, 64, 128, 1024>(alloc);
+    }
+
+    KTL_ADD_TEST(test_size_header_unsized_deallocate)
+    {
+        ktl::size_header<counting_allocator<ktl::mallocator>> alloc;
+
+        void* p1 = alloc.allocate(24);
+        void* p2 = alloc.allocate(100);
+
+        KTL_TEST_ASSERT(alloc.size(p1) == 24);
+        KTL_TEST_ASSERT(alloc.size(p2) == 100);
+
+        // The memory should be correctly aligned despite the header
+        KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p1) & detail::ALIGNMENT_MASK) == 0);
+        KTL_TEST_ASSERT((reinterpret_cast<uintptr_t>(p2) & detail::ALIGNMENT_MASK) == 0);
+
+        // The underlying allocator should be given back the same sizes it handed out
+        alloc.deallocate(p2);
+        alloc.deallocate(p1);
+
+        KTL_TEST_ASSERT(alloc.get_allocator().allocated() == 0);
+    }
+
+    KTL_ADD_TEST(test_size_header_segragator_routing)
+    {
+        // Small allocations are recycled by the freelist, even when deallocated without a size
+        ktl::size_header<ktl::segragator<64, ktl::freelist<0, 64, ktl::mallocator>, ktl::mallocator>> alloc;
+
+        void* small = alloc.allocate(16);
+        void* large = alloc.allocate(256);
+
+        KTL_TEST_ASSERT(small);
+        KTL_TEST_ASSERT(large);
+
+        alloc.deallocate(small);
+        alloc.deallocate(large);
+
+        void* reused = alloc.allocate(32);
+
+        KTL_TEST_ASSERT(reused == small);
+
+        alloc.deallocate(reused);
+    }
+
+    KTL_ADD_TEST(test_size_header_owns)
+    {
+        ktl::size_header<ktl::linear_allocator<1024>> alloc;
+
+        void* p = alloc.allocate(32);
+
+        KTL_TEST_ASSERT(p);
+        KTL_TEST_ASSERT(alloc.owns(p));
+        KTL_TEST_ASSERT(alloc.max_size() == 1024 - detail::ALIGNMENT);
+
+        alloc.deallocate(p);
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_size_header_std_vector_double)
+    {
+        std::vector<double, type_size_header_allocator<double, ktl::mallocator>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_size_header_std_vector_complex)
+    {
+        std::vector<complex_t, type_size_header_allocator<complex_t, ktl::mallocator>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file
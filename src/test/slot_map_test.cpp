@@ -0,0 +1,174 @@
+#include "shared/assert_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/containers/slot_map.h"
+
+#include <string>
+#include <vector>
+
+// Naming scheme: test_slot_map_[Type]
+// Contains tests that relate directly to the ktl::slot_map
+
+namespace ktl::test::slot_map
+{
+    KTL_ADD_TEST(test_slot_map_insert_erase)
+    {
+        ktl::slot_map<double> map;
+
+        auto h1 = map.insert(1.0);
+        auto h2 = map.insert(2.0);
+        auto h3 = map.insert(3.0);
+
+        KTL_TEST_ASSERT(map.size() == 3);
+        KTL_TEST_ASSERT(map[h1] == 1.0);
+        KTL_TEST_ASSERT(map[h2] == 2.0);
+        KTL_TEST_ASSERT(map[h3] == 3.0);
+
+        KTL_TEST_ASSERT(map.erase(h1));
+
+        // The last object is moved into the hole, but its handle stays valid
+        KTL_TEST_ASSERT(map.size() == 2);
+        KTL_TEST_ASSERT(!map.contains(h1));
+        KTL_TEST_ASSERT(map.get(h1) == nullptr);
+        KTL_TEST_ASSERT(map[h3] == 3.0);
+        KTL_TEST_ASSERT(map.data()[0] == 3.0);
+
+        // Erasing twice should fail
+        KTL_TEST_ASSERT(!map.erase(h1));
+    }
+
+    KTL_ADD_TEST(test_slot_map_stale_handle)
+    {
+        ktl::slot_map<double> map;
+
+        auto h1 = map.insert(1.0);
+        map.erase(h1);
+
+        // The slot is reused, but with a new generation
+        auto h2 = map.insert(2.0);
+
+        KTL_TEST_ASSERT(h2.Index == h1.Index);
+        KTL_TEST_ASSERT(h2 != h1);
+        KTL_TEST_ASSERT(!map.contains(h1));
+        KTL_TEST_ASSERT(map.get(h1) == nullptr);
+        KTL_TEST_ASSERT(*map.get(h2) == 2.0);
+
+        // A default handle never refers to anything
+        KTL_TEST_ASSERT(!map.contains(decltype(map)::handle{}));
+    }
+
+    KTL_ADD_TEST(test_slot_map_iterate)
+    {
+        ktl::slot_map<size_t> map;
+        std::vector<decltype(map)::handle> handles;
+
+        for (size_t i = 0; i < 100; i++)
+            handles.push_back(map.insert(i));
+
+        // Erase every other object
+        for (size_t i = 0; i < 100; i += 2)
+            KTL_TEST_ASSERT(map.erase(handles[i]));
+
+        KTL_TEST_ASSERT(map.size() == 50);
+
+        size_t sum = 0;
+        for (auto iter = map.begin(); iter != map.end(); iter++)
+        {
+            KTL_TEST_ASSERT(*iter % 2 == 1);
+            KTL_TEST_ASSERT(map.get_handle(iter) == handles[*iter]);
+            sum += *iter;
+        }
+
+        KTL_TEST_ASSERT(sum == 50 * 50);
+
+        for (size_t i = 1; i < 100; i += 2)
+            KTL_TEST_ASSERT(map[handles[i]] == i);
+    }
+
+    KTL_ADD_TEST(test_slot_map_clear)
+    {
+        ktl::slot_map<double> map;
+
+        auto h1 = map.insert(1.0);
+        auto h2 = map.insert(2.0);
+
+        map.clear();
+
+        KTL_TEST_ASSERT(map.empty());
+        KTL_TEST_ASSERT(!map.contains(h1));
+        KTL_TEST_ASSERT(!map.contains(h2));
+
+        auto h3 = map.insert(3.0);
+        KTL_TEST_ASSERT(map[h3] == 3.0);
+        KTL_TEST_ASSERT(!map.contains(h1));
+        KTL_TEST_ASSERT(!map.contains(h2));
+    }
+
+    KTL_ADD_TEST(test_slot_map_complex)
+    {
+        ktl::slot_map<complex_t> map;
+        std::vector<decltype(map)::handle> handles;
+
+        for (size_t i = 0; i < 100; i++)
+            handles.push_back(map.emplace(double(i)));
+
+        for (size_t i = 0; i < 100; i += 3)
+            map.erase(handles[i]);
+
+        // Copies should keep the same handles
+        ktl::slot_map<complex_t> copy = map;
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            if (i % 3 == 0)
+            {
+                KTL_TEST_ASSERT(!copy.contains(handles[i]));
+            }
+            else
+            {
+                KTL_TEST_ASSERT(map[handles[i]] == complex_t(double(i)));
+                KTL_TEST_ASSERT(copy[handles[i]] == complex_t(double(i)));
+            }
+        }
+
+        ktl::slot_map<complex_t> moved = std::move(copy);
+
+        KTL_TEST_ASSERT(copy.empty());
+        KTL_TEST_ASSERT(moved.size() == map.size());
+        KTL_TEST_ASSERT(moved[handles[1]] == complex_t(1.0));
+    }
+
+    KTL_ADD_TEST(test_slot_map_string)
+    {
+        ktl::slot_map<std::string, type_allocator<std::string, mallocator>> map;
+
+        auto h1 = map.emplace("a string which is long enough to be allocated");
+        auto h2 = map.emplace(16, 'x');
+
+        map.erase(h1);
+
+        KTL_TEST_ASSERT(map[h2] == std::string(16, 'x'));
+    }
+
+    KTL_ADD_TEST(test_slot_map_linear_allocator)
+    {
+        type_shared_linear_allocator<double, 4096> alloc;
+        ktl::slot_map<double, type_shared_linear_allocator<double, 4096>> map(alloc);
+
+        std::vector<decltype(map)::handle> handles;
+        for (size_t i = 0; i < 32; i++)
+            handles.push_back(map.insert(double(i)));
+
+        for (size_t i = 0; i < 32; i++)
+            KTL_TEST_ASSERT(map[handles[i]] == double(i));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "shared/assert_utility.h"
+#include "shared/construct_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/containers/small_vector.h"
+
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/stack_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+
+// Naming scheme: test_small_vector_[Alloc]_[Type]
+// Contains tests that relate directly to the ktl::small_vector
+
+namespace ktl::test::small_vector
+{
+    template<size_t N>
+    void assert_construct_small_vector()
+    {
+        using Alloc = ktl::type_shared_linear_allocator<double, 2048>;
+        using Container = ktl::small_vector<double, N, Alloc>;
+
+        constexpr size_t size = 4;
+
+        double values[] = {
+            4.0,
+            8.0,
+            -1.0,
+            10.0
+        };
+
+        Container baseContainer;
+
+        Alloc allocator;
+
+        assert_construct_container<Container>(
+            [&](Container& lhs, Container& rhs)
+        {
+            // Comparison function
+            KTL_TEST_ASSERT(lhs.size() == rhs.size());
+
+            for (size_t i = 0; i < size; i++)
+                KTL_TEST_ASSERT(lhs[i] == rhs[i]);
+        }, [&]()
+        {
+            // Push some elements
+            for (size_t i = 0; i < size; i++)
+                baseContainer.push_back(values[i]);
+
+            return baseContainer;
+        }, [&]()
+        {
+            // Construct using initializer list
+            return Container{ values[0], values[1], values[2], values[3] };
+        }, [&]()
+        {
+            // Construct from pointer range
+            return Container(values, values + size);
+        }, [&]()
+        {
+            // Construct by copying using a different allocator
+            Container container(baseContainer, allocator);
+
+            KTL_TEST_ASSERT(container.is_inline() == (size <= N));
+
+            return container;
+        }, [&]()
+        {
+            // Construct by moving using a different allocator
+            Container container(std::move(baseContainer), allocator);
+
+            KTL_TEST_ASSERT(baseContainer.empty());
+            KTL_TEST_ASSERT(baseContainer.is_inline());
+
+            return container;
+        });
+    }
+
+    KTL_ADD_TEST(test_small_vector_construct_inline)
+    {
+        assert_construct_small_vector<8>();
+    }
+
+    KTL_ADD_TEST(test_small_vector_construct_allocated)
+    {
+        assert_construct_small_vector<2>();
+    }
+
+    KTL_ADD_TEST(test_small_vector_spill)
+    {
+        ktl::small_vector<double, 4> vec;
+
+        KTL_TEST_ASSERT(vec.is_inline());
+        KTL_TEST_ASSERT(vec.capacity() == 4);
+
+        for (size_t i = 0; i < 4; i++)
+            vec.push_back(double(i));
+
+        KTL_TEST_ASSERT(vec.is_inline());
+
+        // Outgrowing the inline storage should move the elements to the allocator
+        vec.push_back(4.0);
+
+        KTL_TEST_ASSERT(!vec.is_inline());
+        KTL_TEST_ASSERT(vec.capacity() > 4);
+
+        for (size_t i = 0; i < 5; i++)
+            KTL_TEST_ASSERT(vec[i] == double(i));
+
+        // Erasing and shrinking should move them back again
+        vec.erase(vec.begin(), vec.begin() + 2);
+        vec.shrink_to_fit();
+
+        KTL_TEST_ASSERT(vec.is_inline());
+        KTL_TEST_ASSERT(vec.size() == 3);
+
+        for (size_t i = 0; i < 3; i++)
+            KTL_TEST_ASSERT(vec[i] == double(i + 2));
+    }
+
+    KTL_ADD_TEST(test_small_vector_move)
+    {
+        ktl::small_vector<double, 4> inlined{ 1.0, 2.0 };
+        ktl::small_vector<double, 4> allocated{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+        const double* data = allocated.data();
+
+        // Moving inline elements copies them
+        ktl::small_vector<double, 4> inlinedMove(std::move(inlined));
+
+        KTL_TEST_ASSERT(inlinedMove.is_inline());
+        KTL_TEST_ASSERT(inlinedMove.size() == 2);
+        KTL_TEST_ASSERT(inlinedMove[1] == 2.0);
+        KTL_TEST_ASSERT(inlined.empty());
+
+        // Moving allocated elements steals the memory
+        ktl::small_vector<double, 4> allocatedMove;
+        allocatedMove = std::move(allocated);
+
+        KTL_TEST_ASSERT(allocatedMove.data() == data);
+        KTL_TEST_ASSERT(allocatedMove.size() == 5);
+        KTL_TEST_ASSERT(allocated.empty());
+        KTL_TEST_ASSERT(allocated.is_inline());
+
+        // Assigning an inline vector over an allocated one
+        allocatedMove = std::move(inlinedMove);
+
+        KTL_TEST_ASSERT(allocatedMove.is_inline());
+        KTL_TEST_ASSERT(allocatedMove.size() == 2);
+        KTL_TEST_ASSERT(allocatedMove[0] == 1.0);
+    }
+
+    KTL_ADD_TEST(test_small_vector_emplace)
+    {
+        ktl::small_vector<double, 2> vec{ 1.0, 3.0 };
+
+        // Emplacing into a full vector reallocates before inserting
+        auto iter = vec.emplace(vec.begin() + 1, 2.0);
+
+        KTL_TEST_ASSERT(*iter == 2.0);
+        KTL_TEST_ASSERT(vec.size() == 3);
+
+        for (size_t i = 0; i < 3; i++)
+            KTL_TEST_ASSERT(vec[i] == double(i + 1));
+    }
+
+    KTL_ADD_TEST(test_small_vector_inline_double)
+    {
+        ktl::small_vector<double, 16, type_linear_allocator<double, 4096>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_small_vector_linear_double)
+    {
+        ktl::small_vector<double, 2, type_linear_allocator<double, 4096>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_small_vector_linear_trivial)
+    {
+        ktl::small_vector<trivial_t, 2, type_linear_allocator<trivial_t, 4096>> vec;
+        assert_vector_values<trivial_t>(vec);
+    }
+
+    KTL_ADD_TEST(test_small_vector_stack_trivial)
+    {
+        using Alloc = ktl::type_stack_allocator<trivial_t, 4096>;
+
+        stack<4096> block;
+        Alloc alloc(ktl::stack_allocator<4096>{ block });
+        ktl::small_vector<trivial_t, 2, Alloc> vec(alloc);
+        assert_vector_values<trivial_t>(vec);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "shared/assert_utility.h"
+#include "shared/construct_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/unordered_map_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/containers/unordered_map.h"
+
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/overflow.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <sstream>
+#include <string>
+
+// Naming scheme: test_unordered_map_[Alloc]_[Type]
+// Contains tests that relate directly to the ktl::unordered_map
+
+namespace ktl::test::unordered_map
+{
+    KTL_ADD_TEST(test_unordered_map_construct)
+    {
+        using Container = ktl::unordered_map<std::string, double>;
+
+        Container baseContainer;
+
+        assert_construct_container<Container>(
+            [&](Container& lhs, Container& rhs)
+        {
+            // Comparison function
+            KTL_TEST_ASSERT(lhs.size() == rhs.size());
+
+            for (auto& [key, value] : rhs)
+            {
+                auto iter = lhs.find(key);
+
+                KTL_TEST_ASSERT(iter != lhs.end());
+                KTL_TEST_ASSERT(iter->second == value);
+            }
+        }, [&]()
+        {
+            // Insert some elements
+            for (size_t i = 0; i < 100; i++)
+                baseContainer.insert(std::to_string(i), double(i));
+
+            return baseContainer;
+        });
+    }
+
+    KTL_ADD_TEST(test_unordered_map_grow_erase)
+    {
+        ktl::unordered_map<size_t, size_t> map;
+
+        // Grow the map several times
+        for (size_t i = 0; i < 1000; i++)
+            KTL_TEST_ASSERT(map.insert(i, i * 2).second);
+
+        KTL_TEST_ASSERT(map.size() == 1000);
+        KTL_TEST_ASSERT(!map.insert(size_t(5), size_t(0)).second);
+
+        for (size_t i = 0; i < 1000; i++)
+            KTL_TEST_ASSERT(map[i] == i * 2);
+
+        for (size_t i = 1000; i < 2000; i++)
+            KTL_TEST_ASSERT(map.find(i) == map.end());
+
+        // Erase every other key
+        for (size_t i = 0; i < 1000; i += 2)
+            KTL_TEST_ASSERT(map.erase(i) == 1);
+
+        KTL_TEST_ASSERT(map.size() == 500);
+
+        for (size_t i = 0; i < 1000; i++)
+            KTL_TEST_ASSERT(map.contains(i) == (i % 2 == 1));
+
+        size_t count = 0;
+        for (auto& [key, value] : map)
+        {
+            KTL_TEST_ASSERT(value == key * 2);
+            count++;
+        }
+
+        KTL_TEST_ASSERT(count == 500);
+    }
+
+    KTL_ADD_TEST(test_unordered_map_churn)
+    {
+        ktl::unordered_map<size_t, size_t> map;
+
+        map.reserve(64);
+
+        size_t capacity = map.capacity();
+
+        // Repeatedly inserting and erasing leaves deleted slots behind, which must be reclaimed without growing
+        for (size_t i = 0; i < 10000; i++)
+        {
+            map.insert(i, i);
+
+            if (i >= 32)
+                KTL_TEST_ASSERT(map.erase(i - 32) == 1);
+        }
+
+        KTL_TEST_ASSERT(map.size() == 32);
+        KTL_TEST_ASSERT(map.capacity() == capacity);
+
+        for (size_t i = 10000 - 32; i < 10000; i++)
+            KTL_TEST_ASSERT(map.contains(i));
+
+        map.clear();
+
+        KTL_TEST_ASSERT(map.empty());
+        KTL_TEST_ASSERT(map.begin() == map.end());
+    }
+
+    KTL_ADD_TEST(test_unordered_map_subscript)
+    {
+        ktl::unordered_map<std::string, std::string> map;
+
+        map["key"] += "first";
+        map["key"] += "second";
+        map["other"];
+
+        KTL_TEST_ASSERT(map.size() == 2);
+        KTL_TEST_ASSERT(map["key"] == "firstsecond");
+        KTL_TEST_ASSERT(map["other"].empty());
+    }
+
+    KTL_ADD_TEST(test_unordered_map_std_double)
+    {
+        ktl::unordered_map<std::string, double> map;
+        assert_unordered_map_values<double>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_map_std_complex)
+    {
+        ktl::unordered_map<std::string, complex_t> map;
+        assert_unordered_map_values<complex_t>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_map_linear_trivial)
+    {
+        using Alloc = type_linear_allocator<std::pair<const std::string, trivial_t>, 4096>;
+
+        ktl::unordered_map<std::string, trivial_t, std::hash<std::string>, std::equal_to<std::string>, Alloc> map;
+        assert_unordered_map_values<trivial_t>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_map_overflow_packed)
+    {
+        std::stringstream stream;
+        {
+            using Alloc = type_overflow_allocator<std::pair<const std::string, packed_t>, mallocator, std::stringstream>;
+
+            Alloc alloc(stream);
+            {
+                ktl::unordered_map<std::string, packed_t, std::hash<std::string>, std::equal_to<std::string>, Alloc> map(alloc);
+                assert_unordered_map_values<packed_t>(map);
+            }
+        }
+        KTL_TEST_ASSERT(stream.str().empty());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "shared/assert_utility.h"
+#include "shared/construct_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/unordered_multimap_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/containers/unordered_multimap.h"
+
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/overflow.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <sstream>
+#include <string>
+
+// Naming scheme: test_unordered_multimap_[Alloc]_[Type]
+// Contains tests that relate directly to the ktl::unordered_multimap
+
+namespace ktl::test::unordered_multimap
+{
+    KTL_ADD_TEST(test_unordered_multimap_construct)
+    {
+        using Container = ktl::unordered_multimap<std::string, double>;
+
+        Container baseContainer;
+
+        assert_construct_container<Container>(
+            [&](Container& lhs, Container& rhs)
+        {
+            // Comparison function
+            KTL_TEST_ASSERT(lhs.size() == rhs.size());
+
+            for (auto& [key, value] : rhs)
+            {
+                KTL_TEST_ASSERT(lhs.count(key) == rhs.count(key));
+
+                bool exists = false;
+                for (auto iter = lhs.find(key); iter; ++iter)
+                    exists |= iter->second == value;
+
+                KTL_TEST_ASSERT(exists);
+            }
+        }, [&]()
+        {
+            // Insert some elements, 4 for each key
+            for (size_t i = 0; i < 100; i++)
+                baseContainer.insert(std::to_string(i % 25), double(i));
+
+            return baseContainer;
+        });
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_equal_range)
+    {
+        ktl::unordered_multimap<size_t, size_t> map;
+
+        // A few keys with many values each
+        for (size_t i = 0; i < 1000; i++)
+            map.insert(i % 10, i);
+
+        KTL_TEST_ASSERT(map.size() == 1000);
+
+        for (size_t key = 0; key < 10; key++)
+        {
+            auto [first, last] = map.equal_range(key);
+
+            // The values are stored next to each other
+            KTL_TEST_ASSERT(size_t(last - first) == 100);
+            KTL_TEST_ASSERT(map.count(key) == 100);
+
+            for (auto iter = first; iter != last; ++iter)
+            {
+                KTL_TEST_ASSERT(iter->first == key);
+                KTL_TEST_ASSERT(iter->second % 10 == key);
+            }
+        }
+
+        auto [first, last] = map.equal_range(10);
+
+        KTL_TEST_ASSERT(first == last);
+        KTL_TEST_ASSERT(!map.find(10));
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_erase)
+    {
+        ktl::unordered_multimap<size_t, size_t> map;
+
+        for (size_t i = 0; i < 100; i++)
+            map.insert(i % 4, i);
+
+        // Erase all even values of key 0 using the key iterator
+        for (auto iter = map.find(0); iter;)
+        {
+            if (iter->second % 8 == 0)
+                iter = map.erase(iter);
+            else
+                ++iter;
+        }
+
+        KTL_TEST_ASSERT(map.count(0) == 12);
+        KTL_TEST_ASSERT(map.size() == 87);
+
+        // Erase a whole key
+        KTL_TEST_ASSERT(map.erase(size_t(1)) == 25);
+        KTL_TEST_ASSERT(map.erase(size_t(1)) == 0);
+        KTL_TEST_ASSERT(!map.contains(1));
+        KTL_TEST_ASSERT(map.size() == 62);
+
+        size_t count = 0;
+        for (auto& [key, value] : map)
+        {
+            KTL_TEST_ASSERT(value % 4 == key);
+            count++;
+        }
+
+        KTL_TEST_ASSERT(count == 62);
+
+        map.clear();
+
+        KTL_TEST_ASSERT(map.empty());
+        KTL_TEST_ASSERT(map.capacity() == 0);
+        KTL_TEST_ASSERT(map.begin() == map.end());
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_stateful_hash)
+    {
+        struct seeded_hash
+        {
+            size_t Seed = 0;
+
+            size_t operator()(size_t key) const noexcept
+            {
+                return std::hash<size_t>()(key) ^ Seed;
+            }
+        };
+
+        typedef ktl::unordered_multimap<size_t, size_t, seeded_hash, std::equal_to<size_t>> map_t;
+
+        map_t map(seeded_hash{ 1234 }, std::equal_to<size_t>());
+
+        for (size_t i = 0; i < 16; i++)
+            map.insert(i % 4, i);
+
+        // Copies should keep the hash function of the original
+        map_t copy(map);
+
+        KTL_TEST_ASSERT(copy.hash_function().Seed == 1234);
+        KTL_TEST_ASSERT(copy.count(2) == 4);
+
+        map_t assigned;
+        assigned = map;
+
+        KTL_TEST_ASSERT(assigned.hash_function().Seed == 1234);
+        KTL_TEST_ASSERT(assigned.count(3) == 4);
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_std_double)
+    {
+        ktl::unordered_multimap<std::string, double> map;
+        assert_unordered_multimap_values<double>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_std_complex)
+    {
+        ktl::unordered_multimap<std::string, complex_t> map;
+        assert_unordered_multimap_values<complex_t>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_linear_trivial)
+    {
+        using Alloc = type_shared_linear_allocator<std::pair<const std::string, trivial_t>, 4096>;
+
+        ktl::unordered_multimap<std::string, trivial_t, std::hash<std::string>, std::equal_to<std::string>, Alloc> map;
+        assert_unordered_multimap_values<trivial_t>(map);
+    }
+
+    KTL_ADD_TEST(test_unordered_multimap_overflow_packed)
+    {
+        std::stringstream stream;
+        {
+            using Alloc = type_overflow_allocator<std::pair<const std::string, packed_t>, mallocator, std::stringstream>;
+
+            Alloc alloc(stream);
+            {
+                ktl::unordered_multimap<std::string, packed_t, std::hash<std::string>, std::equal_to<std::string>, Alloc> map(alloc);
+                assert_unordered_multimap_values<packed_t>(map);
+            }
+        }
+        KTL_TEST_ASSERT(stream.str().empty());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,324 @@
+#include "shared/assert_utility.h"
+#include "shared/construct_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/containers/vector.h"
+
+#include "ktl/allocators/linear_allocator.h"
+#include "ktl/allocators/mallocator.h"
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/stack_allocator.h"
+#include "ktl/allocators/type_allocator.h"
+
+#include <memory>
+#include <string>
+
+// Naming scheme: test_vector_[Alloc]_[Type]
+// Contains tests that relate directly to the ktl::vector
+
+namespace ktl::test::vector
+{
+    // Counts how many times any instance has been copied or moved
+    struct counted_t
+    {
+        inline static size_t Copies = 0;
+        inline static size_t Moves = 0;
+
+        counted_t(int value = 0) noexcept : Value(new int(value)) {}
+
+        counted_t(const counted_t& other) noexcept : Value(new int(*other.Value)) { Copies++; }
+
+        counted_t(counted_t&& other) noexcept : Value(std::move(other.Value)) { Moves++; }
+
+        counted_t& operator=(const counted_t& other) noexcept { Value.reset(new int(*other.Value)); Copies++; return *this; }
+
+        counted_t& operator=(counted_t&& other) noexcept { Value = std::move(other.Value); Moves++; return *this; }
+
+        static void reset() noexcept { Copies = 0; Moves = 0; }
+
+        std::unique_ptr<int> Value;
+    };
+
+    // Same as counted_t, but with a move constructor that may throw
+    struct throwing_t : counted_t
+    {
+        using counted_t::counted_t;
+
+        throwing_t(const throwing_t& other) = default;
+
+        throwing_t(throwing_t&& other) noexcept(false) : counted_t(std::move(other)) {}
+
+        throwing_t& operator=(const throwing_t& other) = default;
+
+        throwing_t& operator=(throwing_t&& other) = default;
+    };
+
+    // Same as counted_t, but opted into relocating with memcpy
+    struct relocatable_t : counted_t
+    {
+        using counted_t::counted_t;
+    };
+}
+
+template<>
+struct ktl::is_trivially_relocatable<ktl::test::vector::relocatable_t> : std::true_type {};
+
+namespace ktl::test::vector
+{
+    template<typename T>
+    void assert_growth(size_t expectedMoves, size_t expectedCopies)
+    {
+        counted_t::reset();
+
+        {
+            ktl::vector<T> vec;
+
+            for (int i = 0; i < 100; i++)
+                vec.emplace_back(i);
+
+            for (int i = 0; i < 100; i++)
+                KTL_TEST_ASSERT(*vec[i].Value == i);
+
+            KTL_TEST_ASSERT((counted_t::Moves > 0) == (expectedMoves > 0));
+            KTL_TEST_ASSERT((counted_t::Copies > 0) == (expectedCopies > 0));
+        }
+    }
+
+    KTL_ADD_TEST(test_vector_construct)
+    {
+        using Alloc = ktl::type_shared_linear_allocator<complex_t, 2048>;
+        using Container = ktl::vector<complex_t, Alloc>;
+
+        constexpr size_t size = 4;
+
+        complex_t values[] = {
+            4.0,
+            8.0,
+            -1.0,
+            10.0
+        };
+
+        Container baseContainer;
+
+        Alloc allocator;
+
+        assert_construct_container<Container>(
+            [&](Container& lhs, Container& rhs)
+        {
+            // Comparison function
+            KTL_TEST_ASSERT(lhs.size() == rhs.size());
+
+            for (size_t i = 0; i < size; i++)
+                KTL_TEST_ASSERT(lhs[i] == rhs[i]);
+        }, [&]()
+        {
+            // Push some elements
+            for (size_t i = 0; i < size; i++)
+                baseContainer.push_back(values[i]);
+
+            return baseContainer;
+        }, [&]()
+        {
+            // Construct using initializer list
+            return Container{ values[0], values[1], values[2], values[3] };
+        }, [&]()
+        {
+            // Construct from pointer range
+            return Container(values, values + size);
+        }, [&]()
+        {
+            // Construct by copying using a different allocator
+            Container container(baseContainer, allocator);
+
+            KTL_TEST_ASSERT(allocator.owns(container.begin()));
+
+            return container;
+        }, [&]()
+        {
+            // Construct by moving using a different allocator
+            Container container(std::move(baseContainer), allocator);
+
+            KTL_TEST_ASSERT(baseContainer.empty());
+            KTL_TEST_ASSERT(allocator.owns(container.begin()));
+
+            return container;
+        });
+    }
+
+    KTL_ADD_TEST(test_vector_growth_nothrow_move)
+    {
+        // Elements are moved when the move constructor is noexcept
+        assert_growth<counted_t>(1, 0);
+    }
+
+    KTL_ADD_TEST(test_vector_growth_throwing_move)
+    {
+        // Elements are copied when the move constructor may throw
+        assert_growth<throwing_t>(0, 1);
+    }
+
+    KTL_ADD_TEST(test_vector_growth_relocatable)
+    {
+        // Elements are neither copied nor moved when they are trivially relocatable
+        assert_growth<relocatable_t>(0, 0);
+    }
+
+    KTL_ADD_TEST(test_vector_growth_expand)
+    {
+        ktl::vector<counted_t, type_linear_allocator<counted_t, 4096>> vec;
+
+        vec.reserve(4);
+
+        counted_t* data = vec.data();
+
+        counted_t::reset();
+
+        // The last allocation of a linear allocator can grow in place
+        for (int i = 0; i < 32; i++)
+            vec.emplace_back(i);
+
+        KTL_TEST_ASSERT(vec.data() == data);
+        KTL_TEST_ASSERT(counted_t::Moves == 0);
+        KTL_TEST_ASSERT(counted_t::Copies == 0);
+    }
+
+    KTL_ADD_TEST(test_vector_push_self)
+    {
+        ktl::vector<std::string> vec{ "a long string which does not fit in the small string buffer" };
+
+        // Pushing an element of the vector itself, while growing
+        for (size_t i = 0; i < 16; i++)
+            vec.push_back(vec[0]);
+
+        for (auto& element : vec)
+            KTL_TEST_ASSERT(element == vec[0]);
+    }
+
+    KTL_ADD_TEST(test_vector_emplace_erase)
+    {
+        ktl::vector<std::string> vec{ "a", "c", "e" };
+
+        vec.emplace(vec.begin() + 1, "b");
+        vec.emplace(vec.begin() + 3, "d");
+        vec.emplace(vec.end(), "f");
+
+        KTL_TEST_ASSERT(vec.size() == 6);
+
+        const char* expected[] = { "a", "b", "c", "d", "e", "f" };
+        for (size_t i = 0; i < 6; i++)
+            KTL_TEST_ASSERT(vec[i] == expected[i]);
+
+        vec.erase(vec.begin(), vec.begin() + 2);
+        vec.erase(vec.begin() + 1);
+
+        KTL_TEST_ASSERT(vec.size() == 3);
+        KTL_TEST_ASSERT(vec[0] == "c");
+        KTL_TEST_ASSERT(vec[1] == "e");
+        KTL_TEST_ASSERT(vec[2] == "f");
+    }
+
+    KTL_ADD_TEST(test_vector_emplace_erase_relocatable)
+    {
+        ktl::vector<relocatable_t> vec;
+
+        for (int i = 0; i < 8; i += 2)
+            vec.emplace_back(i);
+
+        for (int i = 1; i < 8; i += 2)
+            vec.emplace(vec.begin() + i, i);
+
+        for (int i = 0; i < 8; i++)
+            KTL_TEST_ASSERT(*vec[i].Value == i);
+
+        vec.erase(vec.begin() + 2, vec.begin() + 6);
+
+        KTL_TEST_ASSERT(vec.size() == 4);
+        KTL_TEST_ASSERT(*vec[1].Value == 1);
+        KTL_TEST_ASSERT(*vec[2].Value == 6);
+    }
+
+    KTL_ADD_TEST(test_vector_resize)
+    {
+        ktl::vector<std::unique_ptr<int>> vec(4);
+
+        KTL_TEST_ASSERT(vec.size() == 4);
+        KTL_TEST_ASSERT(!vec[3]);
+
+        vec[0] = std::make_unique<int>(42);
+        vec.resize(1);
+        vec.shrink_to_fit();
+
+        KTL_TEST_ASSERT(vec.capacity() == 1);
+        KTL_TEST_ASSERT(*vec[0] == 42);
+
+        ktl::vector<std::string> strings(3, "value");
+        strings.resize(6, strings[0]);
+
+        for (auto& element : strings)
+            KTL_TEST_ASSERT(element == "value");
+    }
+
+    KTL_ADD_TEST(test_vector_resize_growth)
+    {
+        ktl::vector<double> vec;
+        ktl::vector<std::string> strings;
+
+        size_t reallocations = 0;
+        size_t string_reallocations = 0;
+
+        // Growing one element at a time should grow the capacity geometrically, like push_back
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t capacity = vec.capacity();
+            size_t string_capacity = strings.capacity();
+
+            vec.resize(vec.size() + 1);
+            strings.resize(strings.size() + 1, "value");
+
+            reallocations += vec.capacity() != capacity;
+            string_reallocations += strings.capacity() != string_capacity;
+        }
+
+        KTL_TEST_ASSERT(reallocations < 20);
+        KTL_TEST_ASSERT(string_reallocations < 20);
+
+        // Reserving should still be exact
+        size_t capacity = vec.capacity() + 1;
+        vec.reserve(capacity);
+
+        KTL_TEST_ASSERT(vec.capacity() == capacity);
+    }
+
+    KTL_ADD_TEST(test_vector_std_complex)
+    {
+        ktl::vector<complex_t> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+
+    KTL_ADD_TEST(test_vector_linear_complex)
+    {
+        ktl::vector<complex_t, type_linear_allocator<complex_t, 4096>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+
+    KTL_ADD_TEST(test_vector_stack_complex)
+    {
+        using Alloc = ktl::type_stack_allocator<complex_t, 4096>;
+
+        stack<4096> block;
+        Alloc alloc(ktl::stack_allocator<4096>{ block });
+        ktl::vector<complex_t, Alloc> vec(alloc);
+        assert_vector_values<complex_t>(vec);
+    }
+
+    KTL_ADD_TEST(test_vector_linear_trivial)
+    {
+        ktl::vector<trivial_t, type_linear_allocator<trivial_t, 4096>> vec;
+        assert_vector_values<trivial_t>(vec);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "shared/allocation_utility.h"
+#include "shared/test.h"
+#include "shared/types.h"
+#include "shared/vector_utility.h"
+
+#include "ktl/ktl_alloc_fwd.h"
+#include "ktl/ktl_container_fwd.h"
+
+#define KTL_DEBUG_ASSERT
+#include "ktl/allocators/shared.h"
+#include "ktl/allocators/type_allocator.h"
+#include "ktl/allocators/virtual_allocator.h"
+#include "ktl/containers/trivial_vector.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Naming scheme: test_virtual_allocator_[Type]
+// Contains tests that relate directly to the ktl::virtual_allocator
+
+namespace ktl::test::virtual_allocator
+{
+    // Reserve 1 GB, which should barely take up any physical memory
+    constexpr size_t Reserve = size_t(1) << 30;
+
+    KTL_ADD_TEST(test_virtual_raw_allocate)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+        assert_raw_allocate_deallocate<2, 4, 8, 16, 32, 64>(alloc);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_unordered_double)
+    {
+        type_virtual_allocator<double, Reserve> alloc;
+        assert_unordered_values<double>(alloc);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_commit)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+
+        KTL_TEST_ASSERT(alloc.committed() == 0);
+
+        // Write to 4 MB of memory, which should be committed on demand
+        constexpr size_t size = 4 * 1024 * 1024;
+        void* p = alloc.allocate(size);
+
+        KTL_TEST_ASSERT(p);
+        KTL_TEST_ASSERT(alloc.owns(p));
+        KTL_TEST_ASSERT(alloc.owns(static_cast<char*>(p) + size - 1));
+        KTL_TEST_ASSERT(alloc.committed() >= size);
+
+        std::memset(p, 0xFF, size);
+
+        // Resetting should give the memory back, but keep the addresses
+        alloc.reset();
+
+        KTL_TEST_ASSERT(alloc.committed() == 0);
+
+        void* p2 = alloc.allocate(64);
+        KTL_TEST_ASSERT(p2 == p);
+
+        // Decommitted pages should be zeroed when committed again
+        KTL_TEST_ASSERT(*static_cast<unsigned char*>(p2) == 0);
+
+        alloc.deallocate(p2, 64);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_trim)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+
+        constexpr size_t size = 1024 * 1024;
+        void* p1 = alloc.allocate(64);
+        void* p2 = alloc.allocate(size);
+
+        KTL_TEST_ASSERT(alloc.committed() > size);
+
+        // Trimming should decommit everything after the first allocation
+        alloc.deallocate(p2, size);
+        alloc.trim();
+
+        KTL_TEST_ASSERT(alloc.committed() == detail::virtual_page_size());
+        KTL_TEST_ASSERT(alloc.owns(p1));
+
+        alloc.deallocate(p1, 64);
+        alloc.trim();
+
+        KTL_TEST_ASSERT(alloc.committed() == 0);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_reserve)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+
+        constexpr size_t size = 1024 * 1024;
+
+        KTL_TEST_ASSERT(alloc.reserve(size));
+        KTL_TEST_ASSERT(!alloc.reserve(Reserve + 1));
+
+        size_t committed = alloc.committed();
+
+        KTL_TEST_ASSERT(committed >= size);
+
+        // Allocating the reserved memory should not commit anything more
+        void* p = alloc.allocate(size);
+
+        KTL_TEST_ASSERT(p);
+        KTL_TEST_ASSERT(alloc.committed() == committed);
+
+        alloc.deallocate(p, size);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_expand)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+
+        void* p1 = alloc.allocate(64);
+        void* p2 = alloc.allocate(64);
+
+        // Only the last allocation can grow in place, but it can grow far past the first commit
+        KTL_TEST_ASSERT(!alloc.expand(p1, 64, 128));
+        KTL_TEST_ASSERT(alloc.expand(p2, 64, 16 * 1024 * 1024));
+        KTL_TEST_ASSERT(!alloc.expand(p2, 16 * 1024 * 1024, Reserve));
+
+        std::memset(p2, 0xFF, 16 * 1024 * 1024);
+
+        alloc.deallocate(p2, 16 * 1024 * 1024);
+        alloc.deallocate(p1, 64);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_owns)
+    {
+        ktl::virtual_allocator<Reserve> alloc;
+
+        int value;
+
+        KTL_TEST_ASSERT(!alloc.owns(&value));
+        KTL_TEST_ASSERT(!alloc.owns(nullptr));
+
+        // A moved-from allocator has no reserved range, so low addresses shouldn't count as owned
+        ktl::virtual_allocator<Reserve> moved = std::move(alloc);
+
+        KTL_TEST_ASSERT(!alloc.owns(reinterpret_cast<void*>(uintptr_t(4096))));
+        KTL_TEST_ASSERT(!alloc.owns(nullptr));
+        KTL_TEST_ASSERT(!moved.owns(&value));
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_trivial_vector_in_place)
+    {
+        ktl::trivial_vector<size_t, type_virtual_allocator<size_t, Reserve>> vec;
+
+        vec.push_back(0);
+
+        size_t* data = vec.data();
+
+        // Growing should never move the data
+        for (size_t i = 1; i < 100000; i++)
+        {
+            vec.push_back(i);
+            KTL_TEST_ASSERT(vec.data() == data);
+        }
+
+        for (size_t i = 0; i < 100000; i++)
+            KTL_TEST_ASSERT(vec[i] == i);
+    }
+
+#pragma region std::vector
+    KTL_ADD_TEST(test_virtual_allocator_std_vector_double)
+    {
+        std::vector<double, type_shared_virtual_allocator<double, Reserve>> vec;
+        assert_vector_values<double>(vec);
+    }
+
+    KTL_ADD_TEST(test_virtual_allocator_std_vector_complex)
+    {
+        std::vector<complex_t, type_shared_virtual_allocator<complex_t, Reserve>> vec;
+        assert_vector_values<complex_t>(vec);
+    }
+#pragma endregion
+}
\ No newline at end of file